@@ -32,6 +32,18 @@ $(TEST_OUTPUT)_SRC := \
 	tests/test_common/test_logger.cpp \
 	$(patsubst $(ROOTDIR)/%,%,$(wildcard $(TEST_PATH)/*.cpp))
 
+ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
+    ifeq ($(strip $(RGB_MATRIX_DRIVER)), custom)
+        $(TEST_OUTPUT)_SRC += tests/test_common/rgb_matrix_fake_driver.c
+    endif
+endif
+
+ifeq ($(strip $(WS2812_DRIVER_REQUIRED)), yes)
+    ifeq ($(strip $(WS2812_DRIVER)), custom)
+        $(TEST_OUTPUT)_SRC := $(patsubst ws2812_custom.c,tests/test_common/ws2812_fake_driver.c,$($(TEST_OUTPUT)_SRC))
+    endif
+endif
+
 $(TEST_OUTPUT)_DEFS := $(OPT_DEFS) "-DKEYMAP_C=\"keymap.c\""
 
 $(TEST_OUTPUT)_CONFIG := $(TEST_PATH)/config.h
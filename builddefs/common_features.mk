@@ -682,7 +682,17 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     # Determine which (if any) transport files are required
     ifneq ($(strip $(SPLIT_TRANSPORT)), custom)
         QUANTUM_SRC += $(QUANTUM_DIR)/split_common/transport.c \
-                       $(QUANTUM_DIR)/split_common/transactions.c
+                       $(QUANTUM_DIR)/split_common/transactions.c \
+                       $(QUANTUM_DIR)/split_common/transaction_schedule.c \
+                       $(QUANTUM_DIR)/split_common/transaction_stream.c
+
+        # Only linked in with SPLIT_TRANSACTION_STATS
+        QUANTUM_LIB_SRC += transaction_stats.c
+
+        ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
+            # Only linked in with RGB_MATRIX_SPLIT and ENABLE_RGB_MATRIX_DIRECT
+            QUANTUM_LIB_SRC += led_frame.c
+        endif
 
         OPT_DEFS += -DSPLIT_COMMON_TRANSACTIONS
 
@@ -700,6 +710,8 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
             QUANTUM_LIB_SRC += serial.c
         else
             QUANTUM_LIB_SRC += serial_protocol.c
+            QUANTUM_LIB_SRC += serial_protocol_batch.c
+            QUANTUM_LIB_SRC += serial_protocol_push.c
             QUANTUM_LIB_SRC += serial_$(strip $(SERIAL_DRIVER)).c
         endif
     endif
@@ -934,6 +946,15 @@ ifeq ($(strip $(DIP_SWITCH_ENABLE)), yes)
     endif
 endif
 
+# RGBLIGHT and RGB Matrix on the same WS2812 chain are composited into a single frame
+ifeq ($(strip $(RGBLIGHT_ENABLE))-$(strip $(RGBLIGHT_DRIVER))-$(strip $(RGB_MATRIX_ENABLE))-$(strip $(RGB_MATRIX_DRIVER)), yes-ws2812-yes-ws2812)
+    LED_COMPOSITOR_ENABLE ?= yes
+endif
+
+ifeq ($(strip $(LED_COMPOSITOR_ENABLE)), yes)
+    WS2812_DRIVER_REQUIRED := yes
+endif
+
 VALID_WS2812_DRIVER_TYPES := bitbang custom i2c pwm spi vendor
 
 WS2812_DRIVER ?= bitbang
@@ -972,7 +993,7 @@ endif
 
 ifeq ($(strip $(I2C_DRIVER_REQUIRED)), yes)
     OPT_DEFS += -DHAL_USE_I2C=TRUE
-    QUANTUM_LIB_SRC += i2c_master.c
+    QUANTUM_LIB_SRC += i2c_master.c i2c_async_queue.c
 endif
 
 ifeq ($(strip $(SPI_DRIVER_REQUIRED)), yes)
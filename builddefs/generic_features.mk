@@ -38,10 +38,12 @@ GENERIC_FEATURES = \
     KEY_OVERRIDE \
     LAYER_LOCK \
     LEADER \
+    LED_COMPOSITOR \
     MAGIC \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    PERF_STATS \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
@@ -50,6 +52,7 @@ GENERIC_FEATURES = \
     SPACE_CADET \
     SWAP_HANDS \
     TAP_DANCE \
+    TRACEPOINT \
     TRI_LAYER \
     VIA \
     VIRTSER \
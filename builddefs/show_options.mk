@@ -82,7 +82,9 @@ OTHER_OPTION_NAMES = \
   CAPS_WORD_ENABLE \
   AUTOCORRECT_ENABLE \
   TRI_LAYER_ENABLE \
-  REPEAT_KEY_ENABLE
+  REPEAT_KEY_ENABLE \
+  PERF_STATS_ENABLE \
+  LED_COMPOSITOR_ENABLE
 
 define NAME_ECHO
        @printf "  %-30s = %-16s # %s\\n" "$1" "$($1)" "$(origin $1)"
@@ -1,10 +1,16 @@
-TEST_LIST = $(sort $(patsubst %/test.mk,%, $(shell find $(ROOT_DIR)tests -type f -name test.mk)))
-FULL_TESTS := $(notdir $(TEST_LIST))
+FULL_TEST_LIST = $(sort $(patsubst %/test.mk,%, $(shell find $(ROOT_DIR)tests -type f -name test.mk)))
+FULL_TESTS := $(notdir $(FULL_TEST_LIST))
+# Timing benchmarks, only built and run by `make bench:...`. Full tests are
+# benchmarks when the name of their directory ends in _benchmark.
+TEST_LIST = $(filter-out %_benchmark,$(FULL_TEST_LIST))
+BENCHMARK_LIST := $(filter %_benchmark,$(FULL_TEST_LIST))
 
 include $(QUANTUM_PATH)/debounce/tests/testlist.mk
 include $(QUANTUM_PATH)/encoder/tests/testlist.mk
 include $(QUANTUM_PATH)/os_detection/tests/testlist.mk
+include $(QUANTUM_PATH)/rgb_matrix/tests/testlist.mk
 include $(QUANTUM_PATH)/sequencer/tests/testlist.mk
+include $(QUANTUM_PATH)/split_common/tests/testlist.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/testlist.mk
 include $(PLATFORM_PATH)/test/testlist.mk
 
@@ -20,3 +26,4 @@ endef
 
 
 $(eval $(call VALIDATE_TEST_LIST,$(firstword $(TEST_LIST)),$(wordlist 2,9999,$(TEST_LIST))))
+$(eval $(call VALIDATE_TEST_LIST,$(firstword $(BENCHMARK_LIST)),$(wordlist 2,9999,$(BENCHMARK_LIST))))
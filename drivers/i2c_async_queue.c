@@ -0,0 +1,76 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "i2c_async_queue.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifdef I2C_ASYNC_ENABLE
+
+static i2c_async_job_t  i2c_jobs[I2C_ASYNC_QUEUE_SIZE];
+static volatile uint8_t i2c_jobs_head  = 0;
+static volatile uint8_t i2c_jobs_count = 0;
+
+// The data of the queued jobs, in the same order. A job's data is never split
+// across the end of the buffer, the bytes left there are skipped instead.
+static uint8_t           i2c_buffer[I2C_ASYNC_BUFFER_SIZE];
+static volatile uint16_t i2c_buffer_head = 0;
+static volatile uint16_t i2c_buffer_used = 0;
+
+bool i2c_async_queue_push(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout, i2c_callback_t callback, void *context) {
+    if (i2c_jobs_count == I2C_ASYNC_QUEUE_SIZE) {
+        return false;
+    }
+
+    uint16_t tail = (i2c_buffer_head + i2c_buffer_used) % I2C_ASYNC_BUFFER_SIZE;
+    uint16_t skip = tail + length > I2C_ASYNC_BUFFER_SIZE ? I2C_ASYNC_BUFFER_SIZE - tail : 0;
+    if (i2c_buffer_used + skip + length > I2C_ASYNC_BUFFER_SIZE) {
+        return false;
+    }
+
+    i2c_async_job_t *job = &i2c_jobs[(i2c_jobs_head + i2c_jobs_count) % I2C_ASYNC_QUEUE_SIZE];
+    job->offset          = skip ? 0 : tail;
+    job->size            = skip + length;
+    memcpy(&i2c_buffer[job->offset], data, length);
+    job->callback = callback;
+    job->context  = context;
+    job->length   = length;
+    job->timeout  = timeout;
+    job->devaddr  = devaddr;
+    job->regaddr  = regaddr;
+    i2c_buffer_used += job->size;
+    i2c_jobs_count++;
+    return true;
+}
+
+i2c_async_job_t *i2c_async_queue_peek(void) {
+    return i2c_jobs_count ? &i2c_jobs[i2c_jobs_head] : NULL;
+}
+
+void i2c_async_queue_pop(void) {
+    if (i2c_jobs_count == 0) {
+        return;
+    }
+    i2c_buffer_used -= i2c_jobs[i2c_jobs_head].size;
+    // Start again from the beginning of the buffer whenever it empties, so fewer bytes are skipped
+    i2c_buffer_head = i2c_buffer_used ? (i2c_buffer_head + i2c_jobs[i2c_jobs_head].size) % I2C_ASYNC_BUFFER_SIZE : 0;
+    i2c_jobs_head   = (i2c_jobs_head + 1) % I2C_ASYNC_QUEUE_SIZE;
+    i2c_jobs_count--;
+}
+
+uint8_t i2c_async_queue_count(void) {
+    return i2c_jobs_count;
+}
+
+void i2c_async_queue_clear(void) {
+    i2c_jobs_head   = 0;
+    i2c_jobs_count  = 0;
+    i2c_buffer_head = 0;
+    i2c_buffer_used = 0;
+}
+
+const uint8_t *i2c_async_job_data(const i2c_async_job_t *job) {
+    return &i2c_buffer[job->offset];
+}
+
+#endif // I2C_ASYNC_ENABLE
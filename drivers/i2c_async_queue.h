@@ -0,0 +1,49 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/* Queue of asynchronous I2C register writes, shared by the platform drivers
+ * implementing i2c_write_register_async(). The queue itself does no locking,
+ * pushes and pops have to be serialised by the caller. */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c_master.h"
+
+#ifndef I2C_ASYNC_QUEUE_SIZE
+#    define I2C_ASYNC_QUEUE_SIZE 32
+#endif
+
+#ifndef I2C_ASYNC_BUFFER_SIZE
+#    define I2C_ASYNC_BUFFER_SIZE 512
+#endif
+
+/* Queued register write. The data is copied into the queue's buffer. */
+typedef struct {
+    i2c_callback_t callback;
+    void          *context;
+    uint16_t       offset;
+    uint16_t       size; // Bytes of the buffer taken, including any skipped at its end
+    uint16_t       length;
+    uint16_t       timeout;
+    uint8_t        devaddr;
+    uint8_t        regaddr;
+} i2c_async_job_t;
+
+/* Queue a write at the back. Returns false if the queue or its buffer is full.
+ * Data longer than I2C_ASYNC_BUFFER_SIZE can never be queued. */
+bool i2c_async_queue_push(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout, i2c_callback_t callback, void *context);
+
+/* The oldest queued write, or NULL if the queue is empty. It stays queued until popped. */
+i2c_async_job_t *i2c_async_queue_peek(void);
+
+/* Drop the oldest queued write, once it has been performed. */
+void i2c_async_queue_pop(void);
+
+uint8_t i2c_async_queue_count(void);
+
+void i2c_async_queue_clear(void);
+
+/* The copy of the data to write for a job. */
+const uint8_t *i2c_async_job_data(const i2c_async_job_t *job);
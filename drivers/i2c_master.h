@@ -4,6 +4,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /**
  * \file
@@ -138,4 +139,57 @@ i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* dat
  */
 i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout);
 
+/**
+ * \brief Callback for a completed asynchronous transaction.
+ *
+ * \param status The result of the transaction, as returned by the synchronous functions.
+ * \param context The context pointer given when the transaction was queued.
+ */
+typedef void (*i2c_callback_t)(i2c_status_t status, void* context);
+
+#if defined(I2C_ASYNC_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a write to a register with an 8-bit address on the I2C device.
+ *
+ * Queued transactions are performed in order, in the background, while this function returns immediately. It only waits when the queue, or the buffer holding the queued data, is full. The synchronous functions above wait for all queued transactions to complete first.
+ *
+ * The data is copied into the queue, so it can be changed as soon as this function returns. Data longer than `I2C_ASYNC_BUFFER_SIZE` does not fit in the queue, and is written synchronously once the queue is empty.
+ *
+ * When `I2C_ASYNC_ENABLE` is not defined, the write is performed synchronously and the callback is called before returning.
+ *
+ * \param devaddr The 7-bit I2C address of the device.
+ * \param regaddr The register address to write to.
+ * \param data A pointer to the data to transmit.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ * \param timeout The time in milliseconds to wait for a response from the target device.
+ * \param callback A function to call with the result once the transaction has completed, or `NULL`. It is called from the thread performing the transactions, and must not call any of the synchronous functions.
+ * \param context A pointer passed to `callback`.
+ *
+ * \return `I2C_STATUS_SUCCESS` once the transaction is queued.
+ */
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout, i2c_callback_t callback, void* context);
+
+/**
+ * \brief Check whether any queued transactions have yet to complete.
+ *
+ * \return `true` if there are transactions in the queue.
+ */
+bool i2c_async_busy(void);
+
+/**
+ * \brief Wait for all queued transactions to complete.
+ */
+void i2c_async_wait(void);
+#else
+static inline i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout, i2c_callback_t callback, void* context) {
+    i2c_status_t status = i2c_write_register(devaddr, regaddr, data, length, timeout);
+    if (callback) {
+        callback(status, context);
+    }
+    return status;
+}
+#    define i2c_async_busy() false
+#    define i2c_async_wait()
+#endif
+
 /** \} */
@@ -97,6 +97,9 @@ void is31fl3731_update_led_control_registers(uint8_t index);
 
 void is31fl3731_flush(void);
 
+// Number of PWM register bytes sent by the last flush.
+uint16_t is31fl3731_get_pwm_bytes_sent(void);
+
 #define C1_1 0x00
 #define C1_2 0x01
 #define C1_3 0x02
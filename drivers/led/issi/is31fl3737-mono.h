@@ -88,6 +88,9 @@ void is31fl3737_update_led_control_registers(uint8_t index);
 
 void is31fl3737_flush(void);
 
+// Number of PWM register bytes sent by the last flush.
+uint16_t is31fl3737_get_pwm_bytes_sent(void);
+
 #define IS31FL3737_PDR_0_OHM 0b000   // No pull-down resistor
 #define IS31FL3737_PDR_0K5_OHM 0b001 // 0.5 kOhm resistor
 #define IS31FL3737_PDR_1K_OHM 0b010  // 1 kOhm resistor
@@ -93,6 +93,9 @@ void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t value);
 
 void is31fl3741_flush(void);
 
+// Number of PWM register bytes sent by the last flush.
+uint16_t is31fl3741_get_pwm_bytes_sent(void);
+
 #define IS31FL3741_PDR_0_OHM 0b000   // No pull-down resistor
 #define IS31FL3741_PDR_0K5_OHM 0b001 // 0.5 kOhm resistor
 #define IS31FL3741_PDR_1K_OHM 0b010  // 1 kOhm resistor
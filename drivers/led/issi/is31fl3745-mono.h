@@ -96,6 +96,9 @@ void is31fl3745_update_scaling_registers(uint8_t index);
 
 void is31fl3745_flush(void);
 
+// Number of PWM register bytes sent by the last flush.
+uint16_t is31fl3745_get_pwm_bytes_sent(void);
+
 #define IS31FL3745_PDR_0_OHM 0b000          // No pull-down resistor
 #define IS31FL3745_PDR_0K5_OHM_SW_OFF 0b001 // 0.5 kOhm resistor in SWx off time
 #define IS31FL3745_PDR_1K_OHM_SW_OFF 0b010  // 1 kOhm resistor in SWx off time
@@ -141,6 +141,9 @@ void snled27351_update_led_control_registers(uint8_t index);
 
 void snled27351_flush(void);
 
+// Number of PWM register bytes sent by the last flush.
+uint16_t snled27351_get_pwm_bytes_sent(void);
+
 void snled27351_sw_return_normal(uint8_t index);
 void snled27351_sw_shutdown(uint8_t index);
 
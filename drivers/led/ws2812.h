@@ -56,7 +56,11 @@
 #    define WS2812_TRST_US 280
 #endif
 
-#if defined(RGBLIGHT_WS2812)
+#if defined(WS2812_LED_COUNT)
+// set by the keyboard
+#elif defined(RGBLIGHT_WS2812) && defined(RGB_MATRIX_WS2812)
+#    define WS2812_LED_COUNT MAX(RGBLIGHT_LED_COUNT, RGB_MATRIX_LED_COUNT)
+#elif defined(RGBLIGHT_WS2812)
 #    define WS2812_LED_COUNT RGBLIGHT_LED_COUNT
 #elif defined(RGB_MATRIX_WS2812)
 #    define WS2812_LED_COUNT RGB_MATRIX_LED_COUNT
@@ -28,6 +28,20 @@ void soft_serial_target_init(void);
 
 bool soft_serial_transaction(int sstd_index);
 
+#ifdef SPLIT_TRANSPORT_BATCH
+// exchange all batched transactions marked in the dirty bitmap, in a single frame
+bool soft_serial_batch_transaction(const uint8_t *dirty);
+#endif
+
+#ifdef SPLIT_TRANSPORT_PUSH
+// slave: push the pushed transactions that changed since the last push, or all of them
+bool soft_serial_push(bool full);
+// master: take in the push frames received so far, returns false if any of them was lost
+bool soft_serial_push_poll(void);
+// master: copy the last pushed data of a transaction to the shared memory, false if it can't be trusted
+bool soft_serial_push_read(int sstd_index);
+#endif
+
 #ifdef SERIAL_DEBUG
 #    include <debug.h>
 #    include <print.h>
@@ -85,6 +85,7 @@ subcommands = [
     'qmk.cli.pytest',
     'qmk.cli.resolve_alias',
     'qmk.cli.test.c',
+    'qmk.cli.trace2json',
     'qmk.cli.userspace.add',
     'qmk.cli.userspace.compile',
     'qmk.cli.userspace.doctor',
@@ -0,0 +1,49 @@
+"""Convert tracepoint output from a keyboard into Chrome trace / Perfetto JSON.
+"""
+import json
+
+from argcomplete.completers import FilesCompleter
+from milc import cli
+
+import qmk.path
+from qmk.commands import dump_lines
+from qmk.tracepoint import decode_records, parse_console_log, to_chrome_trace
+
+
+@cli.argument('-o', '--output', arg_only=True, type=qmk.path.normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('-b', '--binary', arg_only=True, action='store_true', help='Input is a dump of raw records, e.g. read over raw HID, instead of console output')
+@cli.argument('-c', '--clock', arg_only=True, type=int, help='Timestamp clock in Hz. Required for binary input, overrides the clock reported on console.')
+@cli.argument('-n', '--names', arg_only=True, help='Comma separated tracepoint names, in ID order. Overrides the names reported on console.')
+@cli.argument('filename', arg_only=True, type=qmk.path.normpath, completer=FilesCompleter(), help='Console log or binary dump to convert')
+@cli.subcommand('Converts tracepoint output to Chrome trace / Perfetto JSON.')
+def trace2json(cli):
+    """Convert tracepoint output to Chrome trace / Perfetto JSON.
+
+    The input is either the output of `qmk console` while a keyboard with TRACEPOINT_ENABLE is connected, or with `--binary` a raw dump of tracepoint records.
+    """
+    if not cli.args.filename.exists():
+        cli.log.error('File not found: %s', cli.args.filename)
+        return False
+
+    if cli.args.binary:
+        trace = {
+            'clock_hz': None,
+            'names': [],
+            'records': decode_records(cli.args.filename.read_bytes()),
+            'dropped': 0,
+        }
+    else:
+        trace = parse_console_log(cli.args.filename.read_text(encoding='utf-8', errors='replace').splitlines())
+
+    clock_hz = cli.args.clock or trace['clock_hz']
+    if not clock_hz:
+        cli.log.error('Unknown timestamp clock, please supply --clock.')
+        return False
+
+    names = cli.args.names.split(',') if cli.args.names else trace['names']
+
+    if trace['dropped'] and not cli.args.quiet:
+        cli.log.warning('%d events were dropped on the device, the trace is incomplete.', trace['dropped'])
+
+    dump_lines(cli.args.output, [json.dumps(to_chrome_trace(trace['records'], clock_hz, names))], cli.args.quiet)
@@ -0,0 +1,36 @@
+import struct
+
+from qmk.tracepoint import decode_records, parse_console_log, to_chrome_trace
+
+
+def _records(*records):
+    return b''.join(struct.pack('<IBB', *record) for record in records)
+
+
+def test_decode_records():
+    data = _records((1000, 0, ord('B')), (1500, 0, ord('E'))) + b'\x00\x01'
+    assert decode_records(data) == [(1000, 0, ord('B')), (1500, 0, ord('E'))]
+
+
+def test_parse_console_log():
+    lines = [
+        'my_keyboard:1: TP-INFO:1000000:keyboard_task,matrix_task',
+        'my_keyboard:1: TP:' + _records((10, 1, ord('B')), (25, 1, ord('E'))).hex().upper(),
+        'my_keyboard:1: unrelated output',
+        'my_keyboard:1: TP-DROP:3',
+    ]
+    trace = parse_console_log(lines)
+    assert trace['clock_hz'] == 1000000
+    assert trace['names'] == ['keyboard_task', 'matrix_task']
+    assert trace['records'] == [(10, 1, ord('B')), (25, 1, ord('E'))]
+    assert trace['dropped'] == 3
+
+
+def test_to_chrome_trace_unwraps_timestamps():
+    records = [(0xFFFFFFF0, 0, ord('B')), (0x10, 0, ord('E')), (0x20, 1, ord('i'))]
+    trace = to_chrome_trace(records, 1000000, ['keyboard_task'])
+    events = trace['traceEvents']
+    assert [event['ph'] for event in events] == ['B', 'E', 'i']
+    assert events[0]['name'] == 'keyboard_task'
+    assert events[2]['name'] == 'tracepoint_1'
+    assert events[1]['ts'] - events[0]['ts'] == 0x20
@@ -0,0 +1,96 @@
+"""Functions for decoding tracepoint records emitted by quantum/tracepoint.c
+"""
+import re
+import struct
+
+# Matches tracepoint_record_t: uint32_t timestamp, uint8_t id, uint8_t type
+RECORD_FORMAT = '<IBB'
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+EVENT_TYPES = {
+    ord('B'): 'B',
+    ord('E'): 'E',
+    ord('i'): 'i',
+}
+
+info_re = re.compile(r'TP-INFO:(\d+):(.*)$')
+records_re = re.compile(r'TP:([0-9A-Fa-f]*)$')
+dropped_re = re.compile(r'TP-DROP:(\d+)$')
+
+
+def decode_records(data):
+    """Decode a block of raw records into (timestamp, id, type) tuples.
+
+    Trailing partial records are ignored.
+    """
+    records = []
+
+    for offset in range(0, len(data) - RECORD_SIZE + 1, RECORD_SIZE):
+        timestamp, tracepoint_id, event_type = struct.unpack_from(RECORD_FORMAT, data, offset)
+        records.append((timestamp, tracepoint_id, event_type))
+
+    return records
+
+
+def parse_console_log(lines):
+    """Parse console output into a list of records, the clock and the tracepoint names.
+
+    Returns a dictionary with the keys `clock_hz`, `names`, `records` and `dropped`.
+    """
+    trace = {
+        'clock_hz': None,
+        'names': [],
+        'records': [],
+        'dropped': 0,
+    }
+
+    for line in lines:
+        # `qmk console` prefixes each line with the device name, so match anywhere
+        line = line.strip()
+
+        match = info_re.search(line)
+        if match:
+            trace['clock_hz'] = int(match.group(1))
+            trace['names'] = match.group(2).split(',')
+            continue
+
+        match = records_re.search(line)
+        if match:
+            trace['records'].extend(decode_records(bytes.fromhex(match.group(1))))
+            continue
+
+        match = dropped_re.search(line)
+        if match:
+            trace['dropped'] = int(match.group(1))
+
+    return trace
+
+
+def to_chrome_trace(records, clock_hz, names=None, pid=0, tid=0):
+    """Convert decoded records to a Chrome trace / Perfetto compatible dictionary.
+
+    Timestamps are unwrapped, as the on-device counter is only 32 bits wide.
+    """
+    names = names or []
+    events = []
+    wraps = 0
+    last_timestamp = None
+
+    for timestamp, tracepoint_id, event_type in records:
+        if last_timestamp is not None and timestamp < last_timestamp:
+            wraps += 1
+        last_timestamp = timestamp
+
+        ticks = timestamp + (wraps << 32)
+        event = {
+            'name': names[tracepoint_id] if tracepoint_id < len(names) else f'tracepoint_{tracepoint_id}',
+            'ph': EVENT_TYPES.get(event_type, 'i'),
+            'ts': ticks * 1000000 / clock_hz,
+            'pid': pid,
+            'tid': tid,
+        }
+        if event['ph'] == 'i':
+            event['s'] = 't'
+        events.append(event)
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ms'}
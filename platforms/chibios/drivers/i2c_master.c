@@ -32,6 +32,10 @@
 #include <ch.h>
 #include <hal.h>
 
+#ifdef I2C_ASYNC_ENABLE
+#    include "i2c_async_queue.h"
+#endif
+
 #ifndef I2C_DRIVER
 #    define I2C_DRIVER I2CD1
 #endif
@@ -128,6 +132,88 @@ static i2c_status_t i2c_epilogue(const msg_t status) {
     return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
 }
 
+#ifdef I2C_ASYNC_ENABLE
+#    ifndef I2C_ASYNC_THREAD_PRIORITY
+#        define I2C_ASYNC_THREAD_PRIORITY (NORMALPRIO + 1)
+#    endif
+
+static SEMAPHORE_DECL(i2c_jobs_pending, 0);
+static THREADS_QUEUE_DECL(i2c_jobs_idle);
+static THREADS_QUEUE_DECL(i2c_jobs_room);
+static THD_WORKING_AREA(waI2CThread, 512);
+
+static i2c_status_t i2c_write_register_blocking(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
+
+/**
+ * @brief Performs the queued transactions in order. While a transaction is in
+ * progress this thread sleeps, so the keyboard task keeps running.
+ */
+static THD_FUNCTION(I2CThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c");
+
+    while (true) {
+        chSemWait(&i2c_jobs_pending);
+
+        // Only this thread pops, so the job stays in place while it is performed
+        i2c_async_job_t* job    = i2c_async_queue_peek();
+        i2c_status_t     status = i2c_write_register_blocking(job->devaddr, job->regaddr, i2c_async_job_data(job), job->length, job->timeout);
+        if (job->callback) {
+            job->callback(status, job->context);
+        }
+
+        chSysLock();
+        i2c_async_queue_pop();
+        if (i2c_async_queue_count() == 0) {
+            chThdDequeueAllI(&i2c_jobs_idle, MSG_OK);
+        }
+        chThdDequeueAllI(&i2c_jobs_room, MSG_OK);
+        chSchRescheduleS();
+        chSysUnlock();
+    }
+}
+
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout, i2c_callback_t callback, void* context) {
+    static bool thread_started = false;
+    if (!thread_started) {
+        thread_started = true;
+        chThdCreateStatic(waI2CThread, sizeof(waI2CThread), I2C_ASYNC_THREAD_PRIORITY, I2CThread, NULL);
+    }
+
+    // Too long to ever fit in the queue, so write it once the queued transactions are done
+    if (length > I2C_ASYNC_BUFFER_SIZE) {
+        i2c_status_t status = i2c_write_register(devaddr, regaddr, data, length, timeout);
+        if (callback) {
+            callback(status, context);
+        }
+        return status;
+    }
+
+    chSysLock();
+    // Wait for room in the queue, and for its data
+    while (!i2c_async_queue_push(devaddr, regaddr, data, length, timeout, callback, context)) {
+        chThdEnqueueTimeoutS(&i2c_jobs_room, TIME_INFINITE);
+    }
+    chSemSignalI(&i2c_jobs_pending);
+    chSchRescheduleS();
+    chSysUnlock();
+
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_async_busy(void) {
+    return i2c_async_queue_count() != 0;
+}
+
+void i2c_async_wait(void) {
+    chSysLock();
+    if (i2c_async_queue_count() != 0) {
+        chThdEnqueueTimeoutS(&i2c_jobs_idle, TIME_INFINITE);
+    }
+    chSysUnlock();
+}
+#endif
+
 __attribute__((weak)) void i2c_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -149,18 +235,24 @@ __attribute__((weak)) void i2c_init(void) {
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
+#ifdef I2C_ASYNC_ENABLE
+static i2c_status_t i2c_write_register_blocking(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+#else
 i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+#endif
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
     uint8_t complete_packet[length + 1];
@@ -173,7 +265,15 @@ i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t*
     return i2c_epilogue(status);
 }
 
+#ifdef I2C_ASYNC_ENABLE
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
+    return i2c_write_register_blocking(devaddr, regaddr, data, length, timeout);
+}
+#endif
+
 i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
     uint8_t complete_packet[length + 2];
@@ -188,12 +288,14 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
     msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
@@ -9,6 +9,7 @@
 
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
+static inline bool receive_handshake(uint8_t* handshake);
 
 /**
  * @brief This thread runs on the slave and responds to transactions initiated
@@ -55,6 +56,13 @@ static inline bool react_to_transaction(void) {
         return false;
     }
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    /* All batched transactions of a scan come in a single frame. */
+    if ((transaction_id & ~SERIAL_BATCH_FLAGS) == SERIAL_BATCH_TRANSACTION_ID) {
+        return serial_batch_react(transaction_id);
+    }
+#endif
+
     /* Sanity check that we are actually responding to a valid transaction. */
     if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
         return false;
@@ -100,9 +108,15 @@ static inline bool react_to_transaction(void) {
  * @return bool Indicates success of transaction.
  */
 bool soft_serial_transaction(int index) {
+#ifdef SPLIT_TRANSPORT_PUSH
+    /* Take in what the slave pushed so far, rather than throwing it away.
+     * Parts of failed transactions or spurious bytes are cleared along the way. */
+    soft_serial_push_poll();
+#else
     /* Clear the receive queue, to start with a clean slate.
      * Parts of failed transactions or spurious bytes could still be in it. */
     serial_transport_driver_clear();
+#endif
 
     return initiate_transaction((uint8_t)index);
 }
@@ -133,7 +147,7 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
      *   - due to the half duplex limitations on return codes, we always have to read *something*.
      *   - without the read, write only transactions *always* succeed, even during the boot process where the slave is not ready.
      */
-    if (unlikely(!serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake)) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
+    if (unlikely(!receive_handshake(&transaction_id_shake) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
         serial_dprintf("SPLIT: receiving handshake failed\n");
         return false;
     }
@@ -156,3 +170,22 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     return true;
 }
+
+/**
+ * @brief Receive the handshake of the slave, taking in any frames it pushed
+ * before it.
+ */
+static inline bool receive_handshake(uint8_t* handshake) {
+    while (serial_transport_receive(handshake, sizeof(*handshake))) {
+#ifdef SPLIT_TRANSPORT_PUSH
+        if ((*handshake & ~SERIAL_PUSH_FLAGS) == SERIAL_PUSH_TRANSACTION_ID) {
+            if (unlikely(!serial_push_receive(*handshake))) {
+                return false;
+            }
+            continue;
+        }
+#endif
+        return true;
+    }
+    return false;
+}
@@ -47,3 +47,52 @@ bool __attribute__((nonnull, hot)) serial_transport_receive_blocking(uint8_t* de
  * @return false Send failed, e.g. by timeout or bit errors.
  */
 bool __attribute__((nonnull, hot)) serial_transport_send(const uint8_t* source, const size_t size);
+
+#ifdef SPLIT_TRANSPORT_BATCH
+/**
+ * @brief Transaction id which starts a batch frame, rather than a single
+ * transaction. Outside the range of transaction table indices.
+ */
+#    define SERIAL_BATCH_TRANSACTION_ID 0x80
+/**
+ * @brief Flags of the batch transaction id. The slave replies with everything,
+ * rather than what changed, to SERIAL_BATCH_RESYNC. Frames with
+ * SERIAL_BATCH_EMPTY are only a transaction id or handshake.
+ */
+#    define SERIAL_BATCH_RESYNC 0x01
+#    define SERIAL_BATCH_EMPTY 0x02
+#    define SERIAL_BATCH_FLAGS (SERIAL_BATCH_RESYNC | SERIAL_BATCH_EMPTY)
+
+/**
+ * @brief React to a batch frame started by the master, after its transaction
+ * id was received.
+ *
+ * @return true Frame was received intact and answered.
+ * @return false Frame was corrupted or incomplete.
+ */
+bool serial_batch_react(uint8_t transaction_id);
+#endif
+
+#ifdef SPLIT_TRANSPORT_PUSH
+/**
+ * @brief Check if received bytes are waiting in the driver, without blocking.
+ */
+bool serial_transport_available(void);
+
+/**
+ * @brief First byte of a frame pushed by the slave on its own. Outside the range
+ * of handshakes, so that the master can tell push frames and replies apart.
+ * Frames with SERIAL_PUSH_FULL carry all of the pushed data.
+ */
+#    define SERIAL_PUSH_TRANSACTION_ID 0xC0
+#    define SERIAL_PUSH_FULL 0x01
+#    define SERIAL_PUSH_FLAGS (SERIAL_PUSH_FULL)
+
+/**
+ * @brief Receive a push frame on the master, after its first byte was received.
+ *
+ * @return true Frame was received intact.
+ * @return false Frame was corrupted or incomplete.
+ */
+bool serial_push_receive(uint8_t transaction_id);
+#endif
@@ -0,0 +1,220 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Batch frames carry every batched transaction of a scan in a single exchange:
+ *
+ *   master: transaction id | dirty bitmap   | initiator2target buffers of the dirty transactions | crc8
+ *   slave:  handshake      | changed bitmap | target2initiator buffers that changed              | crc8
+ *
+ * Buffers are in transaction table order, the crc covers the bitmap and the
+ * buffers. Nothing is copied to the shared memory unless the crc matched. When
+ * there is nothing to send, the transaction id or handshake is sent on its own,
+ * with SERIAL_BATCH_EMPTY set.
+ *
+ * Both halves keep the target2initiator buffers of the last reply, so that the
+ * slave only sends what changed since. The master asks for all of them with
+ * SERIAL_BATCH_RESYNC whenever it missed a reply, and the slave sends all of
+ * them on its first reply.
+ */
+
+#include <string.h>
+
+#include "crc.h"
+#include "serial.h"
+#include "serial_protocol.h"
+#include "synchronization_util.h"
+
+#ifdef SPLIT_TRANSPORT_BATCH
+
+#    define BATCH_HANDSHAKE(flags) ((SERIAL_BATCH_TRANSACTION_ID | (flags)) ^ NUM_TOTAL_TRANSACTIONS)
+
+// Transaction id or handshake, bitmap, buffers and crc
+static uint8_t batch_frame[1 + SPLIT_BATCH_DIRTY_SIZE + sizeof(split_shared_memory_t) + 1];
+// Target2initiator buffers of the last reply, as sent by the slave or received by the master
+static uint8_t batch_reply[sizeof(split_shared_memory_t)];
+static bool    batch_reply_valid;
+
+static inline bool batch_is_set(const uint8_t *bitmap, uint8_t id) {
+    return bitmap[id / 8] & (1 << (id % 8));
+}
+
+static inline uint8_t batch_buffer_size(uint8_t id, bool reply) {
+    if (!split_transaction_is_batched(id)) {
+        return 0;
+    }
+    const split_transaction_desc_t *trans = &split_transaction_table[id];
+    return reply ? trans->target2initiator_buffer_size : trans->initiator2target_buffer_size;
+}
+
+/**
+ * @brief Check that a bitmap only marks batched transactions with buffers in
+ * the given direction, and return the total size of their buffers.
+ *
+ * @return int Size of the buffers, or -1 for an invalid bitmap.
+ */
+static int batch_size(const uint8_t *bitmap, bool reply) {
+    int size = 0;
+    for (uint8_t id = 0; id < SPLIT_BATCH_DIRTY_SIZE * 8; id++) {
+        if (!batch_is_set(bitmap, id)) {
+            continue;
+        }
+        if (id >= NUM_TOTAL_TRANSACTIONS || !split_transaction_is_batched(id) || (reply && !batch_buffer_size(id, true))) {
+            return -1;
+        }
+        size += batch_buffer_size(id, reply);
+    }
+    return size;
+}
+
+/**
+ * @brief Receive the bitmap, buffers and crc of a frame into the payload of
+ * batch_frame.
+ *
+ * @return int Size of the buffers, or -1 for a corrupted or incomplete frame.
+ */
+static int batch_receive(bool reply) {
+    uint8_t *payload = &batch_frame[1];
+    if (!serial_transport_receive(payload, SPLIT_BATCH_DIRTY_SIZE)) {
+        return -1;
+    }
+
+    /* Sanity check that only batched transactions are part of the frame, which also bounds its size. */
+    int size = batch_size(payload, reply);
+    if (size < 0 || !serial_transport_receive(&payload[SPLIT_BATCH_DIRTY_SIZE], size + 1)) {
+        return -1;
+    }
+    if (payload[SPLIT_BATCH_DIRTY_SIZE + size] != crc8(payload, SPLIT_BATCH_DIRTY_SIZE + size)) {
+        return -1;
+    }
+    return size;
+}
+
+/**
+ * @brief Exchange a batch frame with the slave half.
+ *
+ * @param dirty Bitmap of the transactions to send, in SPLIT_BATCH_DIRTY_SIZE bytes.
+ * @return bool Indicates success of the exchange.
+ */
+bool soft_serial_batch_transaction(const uint8_t *dirty) {
+    /* Clear the receive queue, to start with a clean slate.
+     * Parts of failed transactions or spurious bytes could still be in it. */
+    serial_transport_driver_clear();
+
+    split_shared_memory_lock_autounlock();
+
+    /* The request is sent in one go, the slave answers it as a whole. */
+    uint8_t *payload = &batch_frame[1];
+    size_t   size    = SPLIT_BATCH_DIRTY_SIZE;
+    bool     empty   = true;
+    memcpy(payload, dirty, SPLIT_BATCH_DIRTY_SIZE);
+    for (uint8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (batch_is_set(dirty, id)) {
+            memcpy(&payload[size], split_trans_initiator2target_buffer(&split_transaction_table[id]), batch_buffer_size(id, false));
+            size += batch_buffer_size(id, false);
+            empty = false;
+        }
+    }
+    payload[size] = crc8(payload, size);
+
+    batch_frame[0]    = SERIAL_BATCH_TRANSACTION_ID | (batch_reply_valid ? 0 : SERIAL_BATCH_RESYNC) | (empty ? SERIAL_BATCH_EMPTY : 0);
+    size_t frame_size = empty ? 1 : 1 + size + 1;
+
+    /* Until a reply arrives intact, the master can't tell what the slave thinks it has. */
+    batch_reply_valid = false;
+
+    if (!serial_transport_send(batch_frame, frame_size)) {
+        serial_dprintf("SPLIT: sending batch failed\n");
+        return false;
+    }
+
+    /* The handshake comes on its own first, so that a rejected frame fails without waiting for a timeout. */
+    if (!serial_transport_receive(batch_frame, 1)) {
+        serial_dprintf("SPLIT: receiving batch handshake failed\n");
+        return false;
+    }
+
+    if (batch_frame[0] == BATCH_HANDSHAKE(SERIAL_BATCH_EMPTY)) {
+        /* Nothing changed, the shared memory is refreshed from the last reply below. */
+        memset(payload, 0, SPLIT_BATCH_DIRTY_SIZE);
+    } else if (batch_frame[0] != BATCH_HANDSHAKE(0) || batch_receive(true) < 0) {
+        serial_dprintf("SPLIT: receiving batch reply failed\n");
+        return false;
+    }
+
+    /* Refresh every buffer, the master may have modified its copies since the last reply. */
+    const uint8_t *buffer = &payload[SPLIT_BATCH_DIRTY_SIZE];
+    uint8_t       *last   = batch_reply;
+    for (uint8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        uint8_t length = batch_buffer_size(id, true);
+        if (batch_is_set(payload, id)) {
+            memcpy(last, buffer, length);
+            buffer += length;
+        }
+        memcpy(split_trans_target2initiator_buffer(&split_transaction_table[id]), last, length);
+        last += length;
+    }
+    batch_reply_valid = true;
+
+    return true;
+}
+
+bool serial_batch_react(uint8_t transaction_id) {
+    uint8_t *payload = &batch_frame[1];
+    if (transaction_id & SERIAL_BATCH_EMPTY) {
+        memset(payload, 0, SPLIT_BATCH_DIRTY_SIZE);
+    } else if (batch_receive(false) < 0) {
+        /* Reject the frame, so the master doesn't have to wait for a timeout. */
+        uint8_t handshake = (uint8_t)~BATCH_HANDSHAKE(0);
+        serial_transport_send(&handshake, sizeof(handshake));
+        return false;
+    }
+
+    split_shared_memory_lock_autounlock();
+
+    /* Store the buffers and run the callbacks, in the order of individual transactions. */
+    const uint8_t *buffer = &payload[SPLIT_BATCH_DIRTY_SIZE];
+    for (uint8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (!batch_is_set(payload, id)) {
+            continue;
+        }
+
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        memcpy(split_trans_initiator2target_buffer(trans), buffer, trans->initiator2target_buffer_size);
+        buffer += trans->initiator2target_buffer_size;
+
+        if (trans->slave_callback) {
+            trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        }
+    }
+
+    /* Reply with what changed since the last reply, or everything if the master lost track. */
+    bool     resync = (transaction_id & SERIAL_BATCH_RESYNC) || !batch_reply_valid;
+    uint8_t *reply  = &payload[SPLIT_BATCH_DIRTY_SIZE];
+    uint8_t *last   = batch_reply;
+    int      size   = 0;
+    memset(payload, 0, SPLIT_BATCH_DIRTY_SIZE);
+    for (uint8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        uint8_t        length  = batch_buffer_size(id, true);
+        const uint8_t *current = split_trans_target2initiator_buffer(&split_transaction_table[id]);
+        if (length && (resync || memcmp(last, current, length) != 0)) {
+            memcpy(last, current, length);
+            memcpy(&reply[size], current, length);
+            payload[id / 8] |= 1 << (id % 8);
+            size += length;
+        }
+        last += length;
+    }
+    batch_reply_valid = true;
+
+    if (!size && !resync) {
+        batch_frame[0] = BATCH_HANDSHAKE(SERIAL_BATCH_EMPTY);
+        return serial_transport_send(batch_frame, 1);
+    }
+
+    batch_frame[0]                         = BATCH_HANDSHAKE(0);
+    payload[SPLIT_BATCH_DIRTY_SIZE + size] = crc8(payload, SPLIT_BATCH_DIRTY_SIZE + size);
+    return serial_transport_send(batch_frame, 1 + SPLIT_BATCH_DIRTY_SIZE + size + 1);
+}
+
+#endif // SPLIT_TRANSPORT_BATCH
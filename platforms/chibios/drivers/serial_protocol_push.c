@@ -0,0 +1,147 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * On full-duplex links the slave pushes the data that the master would
+ * otherwise poll for, as soon as it changed:
+ *
+ *   slave: transaction id | changed bitmap | target2initiator buffers that changed | crc8
+ *
+ * Buffers are in transaction table order, the crc covers the bitmap and the
+ * buffers. Push frames share the line from the slave with the replies to the
+ * transactions of the master, but never split one, as both are sent under the
+ * shared memory lock. The master tells them apart by the transaction id, which
+ * no handshake is equal to.
+ *
+ * Every SPLIT_TRANSPORT_PUSH_HEARTBEAT the slave pushes all of its buffers with
+ * SERIAL_PUSH_FULL set, whether they changed or not. The master only serves
+ * reads from pushed data after such a frame, and for as long as frames keep
+ * coming in intact. Otherwise it polls the slave as usual.
+ */
+
+#include <string.h>
+
+#include "crc.h"
+#include "serial.h"
+#include "serial_protocol.h"
+#include "synchronization_util.h"
+#include "timer.h"
+
+#ifdef SPLIT_TRANSPORT_PUSH
+
+// Transaction id, bitmap, buffers and crc
+static uint8_t push_frame[1 + SPLIT_PUSH_BITMAP_SIZE + sizeof(split_shared_memory_t) + 1];
+// Target2initiator buffers of the pushed transactions, as last sent by the slave or received by the master
+static uint8_t push_data[sizeof(split_shared_memory_t)];
+// Whether the other half has the same push_data, as far as this half can tell
+static bool     push_synced;
+static uint32_t push_last_frame;
+
+static inline bool push_is_set(const uint8_t *bitmap, uint8_t id) {
+    return bitmap[id / 8] & (1 << (id % 8));
+}
+
+static inline uint8_t push_buffer_size(uint8_t id) {
+    return split_transaction_is_pushed(id) ? split_transaction_table[id].target2initiator_buffer_size : 0;
+}
+
+bool soft_serial_push(bool full) {
+    split_shared_memory_lock_autounlock();
+
+    /* After a failed push, the master may have missed anything that changed. */
+    full |= !push_synced;
+
+    uint8_t *payload = &push_frame[1];
+    uint8_t *last    = push_data;
+    size_t   size    = SPLIT_PUSH_BITMAP_SIZE;
+    memset(payload, 0, SPLIT_PUSH_BITMAP_SIZE);
+    for (uint8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        uint8_t        length  = push_buffer_size(id);
+        const uint8_t *current = split_trans_target2initiator_buffer(&split_transaction_table[id]);
+        if (length && (full || memcmp(last, current, length) != 0)) {
+            memcpy(last, current, length);
+            memcpy(&payload[size], current, length);
+            payload[id / 8] |= 1 << (id % 8);
+            size += length;
+        }
+        last += length;
+    }
+
+    if (size == SPLIT_PUSH_BITMAP_SIZE) {
+        return true;
+    }
+
+    push_frame[0] = SERIAL_PUSH_TRANSACTION_ID | (full ? SERIAL_PUSH_FULL : 0);
+    payload[size] = crc8(payload, size);
+    push_synced   = serial_transport_send(push_frame, 1 + size + 1);
+    return push_synced;
+}
+
+bool serial_push_receive(uint8_t transaction_id) {
+    uint8_t *payload = &push_frame[1];
+    bool     okay    = serial_transport_receive(payload, SPLIT_PUSH_BITMAP_SIZE);
+
+    /* Sanity check that only pushed transactions are part of the frame, which also bounds its size. */
+    size_t size = 0;
+    for (uint8_t id = 0; okay && id < SPLIT_PUSH_BITMAP_SIZE * 8; id++) {
+        if (push_is_set(payload, id)) {
+            okay = id < NUM_TOTAL_TRANSACTIONS && push_buffer_size(id);
+            size += okay ? push_buffer_size(id) : 0;
+        }
+    }
+    okay = okay && serial_transport_receive(&payload[SPLIT_PUSH_BITMAP_SIZE], size + 1);
+    okay = okay && payload[SPLIT_PUSH_BITMAP_SIZE + size] == crc8(payload, SPLIT_PUSH_BITMAP_SIZE + size);
+    if (!okay) {
+        serial_dprintf("SPLIT: receiving push frame failed\n");
+        push_synced = false;
+        return false;
+    }
+
+    const uint8_t *buffer = &payload[SPLIT_PUSH_BITMAP_SIZE];
+    uint8_t       *last   = push_data;
+    for (uint8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        uint8_t length = push_buffer_size(id);
+        if (push_is_set(payload, id)) {
+            memcpy(last, buffer, length);
+            buffer += length;
+        }
+        last += length;
+    }
+
+    if (transaction_id & SERIAL_PUSH_FULL) {
+        push_synced = true;
+    }
+    push_last_frame = timer_read32();
+    return true;
+}
+
+bool soft_serial_push_poll(void) {
+    bool okay = true;
+    while (serial_transport_available()) {
+        uint8_t transaction_id;
+        if (!serial_transport_receive(&transaction_id, sizeof(transaction_id)) || (transaction_id & ~SERIAL_PUSH_FLAGS) != SERIAL_PUSH_TRANSACTION_ID || !serial_push_receive(transaction_id)) {
+            /* Leftovers of a failed transaction or a broken frame, whatever follows can't be told apart. */
+            serial_transport_driver_clear();
+            push_synced = false;
+            okay        = false;
+        }
+    }
+    return okay;
+}
+
+bool soft_serial_push_read(int index) {
+    if (!push_synced || timer_elapsed32(push_last_frame) >= SPLIT_TRANSPORT_PUSH_TIMEOUT) {
+        return false;
+    }
+
+    split_shared_memory_lock_autounlock();
+
+    const uint8_t *last = push_data;
+    for (uint8_t id = 0; id < index; id++) {
+        last += push_buffer_size(id);
+    }
+    memcpy(split_trans_target2initiator_buffer(&split_transaction_table[index]), last, push_buffer_size(index));
+    return true;
+}
+
+#endif // SPLIT_TRANSPORT_PUSH
@@ -7,6 +7,10 @@
 #include "synchronization_util.h"
 #include "chibios_config.h"
 
+#if defined(SPLIT_TRANSPORT_PUSH) && !defined(SERIAL_USART_FULL_DUPLEX)
+#    error "SPLIT_TRANSPORT_PUSH requires SERIAL_USART_FULL_DUPLEX"
+#endif
+
 #if defined(SERIAL_USART_CONFIG)
 static QMKSerialConfig serial_config = SERIAL_USART_CONFIG;
 #elif defined(MCU_AT32) /* AT32 MCUs */
@@ -82,6 +86,15 @@ inline void serial_transport_driver_clear(void) {
     }
 }
 
+#    ifdef SPLIT_TRANSPORT_PUSH
+inline bool serial_transport_available(void) {
+    osalSysLock();
+    bool available = !iqIsEmptyI(&serial_driver->iqueue);
+    osalSysUnlock();
+    return available;
+}
+#    endif
+
 #elif HAL_USE_SIO
 
 /**
@@ -102,6 +115,12 @@ inline void serial_transport_driver_clear(void) {
     osalSysUnlock();
 }
 
+#    ifdef SPLIT_TRANSPORT_PUSH
+inline bool serial_transport_available(void) {
+    return !sioIsRXEmptyX(serial_driver);
+}
+#    endif
+
 #else
 
 #    error Either the SERIAL or SIO driver has to be activated to use the usart driver for split keyboards.
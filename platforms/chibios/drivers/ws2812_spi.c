@@ -102,68 +102,102 @@
 #    define WS2812_SCK_OUTPUT_MODE PAL_MODE_ALTERNATE(WS2812_SPI_SCK_PAL_MODE) | PAL_OUTPUT_TYPE_PUSHPULL
 #endif
 
-#define BYTES_FOR_LED_BYTE 4
 #ifdef WS2812_RGBW
 #    define WS2812_CHANNELS 4
 #else
 #    define WS2812_CHANNELS 3
 #endif
-#define BYTES_FOR_LED (BYTES_FOR_LED_BYTE * WS2812_CHANNELS)
-#define DATA_SIZE (BYTES_FOR_LED * WS2812_LED_COUNT)
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
-#define PREAMBLE_SIZE 4
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+// Each colour byte expands to 4 bytes on the wire, so the buffer is kept in 32 bit words
+#define PREAMBLE_WORDS 1
+#define DATA_WORDS (WS2812_CHANNELS * WS2812_LED_COUNT)
+#define RESET_WORDS ((RESET_SIZE + 3) / 4)
+#define TXBUF_WORDS (PREAMBLE_WORDS + DATA_WORDS + RESET_WORDS)
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#    error "The WS2812 SPI driver expects a little endian MCU"
+#endif
+
+// A second buffer is encoded while the first one is still being sent
+#if defined(WS2812_SPI_USE_CIRCULAR_BUFFER) || defined(WS2812_SPI_SYNC)
+#    define TXBUF_COUNT 1
+#else
+#    define TXBUF_COUNT 2
+#    define WS2812_SPI_END_CB ws2812_spi_end_cb
+#endif
+
+#ifndef WS2812_SPI_END_CB
+#    define WS2812_SPI_END_CB NULL
+#endif
+
+static uint32_t txbuf[TXBUF_COUNT][TXBUF_WORDS] = {0};
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
+ * the ws2812b protocol, every bit of data is sent as 4 bits on the SPI, 0b1110
+ * for a 1 and 0b1000 for a 0. The table below holds the resulting 4 bytes for
+ * every possible byte of data, in the order they are sent.
  */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
-}
+#define WS2812_SPI_BIT_PAIR(data, pos) ((((data) >> (7 - 2 * (pos))) & 1 ? 0xE0 : 0x80) | (((data) >> (6 - 2 * (pos))) & 1 ? 0x0E : 0x08))
+#define WS2812_SPI_WORD(data) ((uint32_t)WS2812_SPI_BIT_PAIR(data, 0) | ((uint32_t)WS2812_SPI_BIT_PAIR(data, 1) << 8) | ((uint32_t)WS2812_SPI_BIT_PAIR(data, 2) << 16) | ((uint32_t)WS2812_SPI_BIT_PAIR(data, 3) << 24))
+#define WS2812_SPI_WORDS_4(n) WS2812_SPI_WORD(n), WS2812_SPI_WORD(n + 1), WS2812_SPI_WORD(n + 2), WS2812_SPI_WORD(n + 3)
+#define WS2812_SPI_WORDS_16(n) WS2812_SPI_WORDS_4(n), WS2812_SPI_WORDS_4(n + 4), WS2812_SPI_WORDS_4(n + 8), WS2812_SPI_WORDS_4(n + 12)
+#define WS2812_SPI_WORDS_64(n) WS2812_SPI_WORDS_16(n), WS2812_SPI_WORDS_16(n + 16), WS2812_SPI_WORDS_16(n + 32), WS2812_SPI_WORDS_16(n + 48)
 
-static void set_led_color_rgb(ws2812_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+static const uint32_t protocol_lut[256] = {
+    WS2812_SPI_WORDS_64(0),
+    WS2812_SPI_WORDS_64(64),
+    WS2812_SPI_WORDS_64(128),
+    WS2812_SPI_WORDS_64(192),
+};
+
+static void set_led_color_rgb(uint32_t* tx_start, ws2812_led_t color, int pos) {
+    uint32_t* led = &tx_start[WS2812_CHANNELS * pos];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    led[0] = protocol_lut[color.g];
+    led[1] = protocol_lut[color.r];
+    led[2] = protocol_lut[color.b];
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    led[0] = protocol_lut[color.r];
+    led[1] = protocol_lut[color.g];
+    led[2] = protocol_lut[color.b];
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
+    led[0] = protocol_lut[color.b];
+    led[1] = protocol_lut[color.g];
+    led[2] = protocol_lut[color.r];
 #endif
 #ifdef WS2812_RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 3 + j] = get_protocol_eq(color.w, j);
+    led[3] = protocol_lut[color.w];
 #endif
 }
 
+#if TXBUF_COUNT > 1
+static uint8_t       tx_back;    // buffer which is not being sent
+static volatile bool tx_busy;    // a transfer is in progress
+static volatile bool tx_pending; // the back buffer holds a frame waiting for the transfer to finish
+
+// Must be called from a locked state
+static void start_send_i(void) {
+    spiStartSendI(&WS2812_SPI_DRIVER, sizeof(txbuf[0]), txbuf[tx_back]);
+    tx_back ^= 1;
+    tx_busy    = true;
+    tx_pending = false;
+}
+
+static void ws2812_spi_end_cb(SPIDriver* spip) {
+    (void)spip;
+    osalSysLockFromISR();
+    if (tx_pending) {
+        start_send_i();
+    } else {
+        tx_busy = false;
+    }
+    osalSysUnlockFromISR();
+}
+#endif
+
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
 void ws2812_init(void) {
@@ -180,7 +214,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_END_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -199,7 +233,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
+        WS2812_SPI_END_CB, // data_cb
         NULL, // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
@@ -220,7 +254,7 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, sizeof(txbuf[0]), txbuf[0]);
 #endif
 }
 
@@ -240,17 +274,33 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
+#if TXBUF_COUNT > 1
+    // A frame still waiting to be sent is replaced by this one
+    osalSysLock();
+    tx_pending = false;
+    osalSysUnlock();
+
+    uint32_t* tx_start = &txbuf[tx_back][PREAMBLE_WORDS];
+#else
+    uint32_t* tx_start = &txbuf[0][PREAMBLE_WORDS];
+#endif
+
     for (int i = 0; i < WS2812_LED_COUNT; i++) {
-        set_led_color_rgb(ws2812_leds[i], i);
+        set_led_color_rgb(tx_start, ws2812_leds[i], i);
     }
 
-    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
-#    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
-#    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
-#    endif
+    // Each led takes ~0.03ms to send, so the transfer is started in the background and the
+    // next frame is encoded into the other buffer. If that frame is ready before the transfer
+    // has finished, it is sent straight from the end of transfer callback.
+#if defined(WS2812_SPI_SYNC)
+    spiSend(&WS2812_SPI_DRIVER, sizeof(txbuf[0]), txbuf[0]);
+#elif TXBUF_COUNT > 1
+    osalSysLock();
+    if (tx_busy) {
+        tx_pending = true;
+    } else {
+        start_send_i();
+    }
+    osalSysUnlock();
 #endif
 }
@@ -24,3 +24,22 @@ void split_shared_memory_unlock(void) {
     chMtxUnlock(&SPLIT_SHARED_MEMORY_MUTEX);
 }
 #endif
+
+#if defined(RGB_MATRIX_THREADED)
+static MUTEX_DECL(RGB_MATRIX_MUTEX);
+
+/**
+ * @brief Acquire exclusive access to the RGB Matrix state shared between the
+ * render thread and the keyboard task, by locking the mutex guarding it.
+ */
+void rgb_matrix_lock(void) {
+    chMtxLock(&RGB_MATRIX_MUTEX);
+}
+
+/**
+ * @brief Release the RGB Matrix mutex that has been acquired before.
+ */
+void rgb_matrix_unlock(void) {
+    chMtxUnlock(&RGB_MATRIX_MUTEX);
+}
+#endif
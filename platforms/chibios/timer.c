@@ -1,6 +1,7 @@
 #include <ch.h>
 
 #include "timer.h"
+#include "chibios_config.h"
 
 static uint32_t ticks_offset = 0;
 static uint32_t last_ticks   = 0;
@@ -58,12 +59,63 @@ static void update_fn(struct ch_virtual_timer *timer, void *arg) {
 // OVERFLOW_ADJUST_TICKS corresponds to an integer number of seconds).
 #define OVERFLOW_ADJUST_MS (TIME_I2MS(OVERFLOW_ADJUST_TICKS))
 
+#if PORT_SUPPORTS_RT == TRUE
+#    define REALTIME_COUNTER_TICKS_PER_US (REALTIME_COUNTER_CLOCK / 1000000)
+_Static_assert(REALTIME_COUNTER_TICKS_PER_US > 0, "The realtime counter is too slow for microsecond resolution");
+
+static uint32_t        us_last_counter = 0;
+static uint32_t        us_remainder    = 0;
+static uint32_t        us_count        = 0;
+static virtual_timer_t us_update_timer;
+
+#    define US_UPDATE_INTERVAL TIME_MS2I(1000)
+
+// Get the current time in microseconds from the realtime counter.
+// This function must be called from within a system lock zone, and at least once for every overflow of the realtime
+// counter (2**32 / REALTIME_COUNTER_CLOCK seconds, ~25 seconds at 168MHz), which us_update_fn takes care of.
+static inline uint32_t get_system_time_us(void) {
+    uint32_t counter = chSysGetRealtimeCounterX();
+    uint32_t elapsed = counter - us_last_counter;
+    us_last_counter  = counter;
+
+    us_count += elapsed / REALTIME_COUNTER_TICKS_PER_US;
+    us_remainder += elapsed % REALTIME_COUNTER_TICKS_PER_US;
+    if (us_remainder >= REALTIME_COUNTER_TICKS_PER_US) {
+        us_remainder -= REALTIME_COUNTER_TICKS_PER_US;
+        us_count++;
+    }
+
+    return us_count;
+}
+
+// VT callback function to keep the microsecond counter updated across realtime counter overflows.
+static void us_update_fn(struct ch_virtual_timer *timer, void *arg) {
+    (void)arg;
+    chSysLockFromISR();
+    get_system_time_us();
+    chVTSetI(&us_update_timer, US_UPDATE_INTERVAL, us_update_fn, NULL);
+    chSysUnlockFromISR();
+}
+
+uint32_t timer_read_us(void) {
+    syssts_t sts = chSysGetStatusAndLockX();
+    uint32_t us  = get_system_time_us();
+    chSysRestoreStatusX(sts);
+
+    return us;
+}
+#endif
+
 void timer_init(void) {
     timer_clear();
 #if CH_CFG_ST_RESOLUTION < 32
     chVTObjectInit(&update_timer);
     chVTSet(&update_timer, UPDATE_INTERVAL, update_fn, NULL);
 #endif
+#if PORT_SUPPORTS_RT == TRUE
+    chVTObjectInit(&us_update_timer);
+    chVTSet(&us_update_timer, US_UPDATE_INTERVAL, us_update_fn, NULL);
+#endif
 }
 
 void timer_clear(void) {
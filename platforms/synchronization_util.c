@@ -12,6 +12,15 @@ extern inline void split_shared_memory_unlock(void);
 #    endif
 #endif
 
+#if !defined(RGB_MATRIX_THREADED) && defined(RGB_MATRIX_ENABLE)
+extern inline void rgb_matrix_lock(void);
+extern inline void rgb_matrix_unlock(void);
+#endif
+
 #if defined(SPLIT_KEYBOARD)
 QMK_IMPLEMENT_AUTOUNLOCK_HELPERS(split_shared_memory)
 #endif
+
+#if defined(RGB_MATRIX_ENABLE)
+QMK_IMPLEMENT_AUTOUNLOCK_HELPERS(rgb_matrix)
+#endif
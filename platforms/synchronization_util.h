@@ -15,6 +15,15 @@ inline void split_shared_memory_unlock(void){};
 #    endif
 #endif
 
+// Only needed when RGB Matrix renders in its own thread
+#if defined(RGB_MATRIX_THREADED)
+void rgb_matrix_lock(void);
+void rgb_matrix_unlock(void);
+#elif defined(RGB_MATRIX_ENABLE)
+inline void rgb_matrix_lock(void){};
+inline void rgb_matrix_unlock(void){};
+#endif
+
 /* GCCs cleanup attribute expects a function with one parameter, which is a
  * pointer to a type compatible with the variable. As we don't want to expose
  * the platforms internal mutex type this workaround with auto generated adapter
@@ -52,3 +61,14 @@ QMK_DECLARE_AUTOUNLOCK_HELPERS(split_shared_memory)
  */
 #    define split_shared_memory_lock_autounlock QMK_DECLARE_AUTOUNLOCK_CALL(split_shared_memory)
 #endif
+
+#if defined(RGB_MATRIX_ENABLE)
+QMK_DECLARE_AUTOUNLOCK_HELPERS(rgb_matrix)
+
+/**
+ * @brief Acquire exclusive access to the RGB Matrix state shared between the
+ * render thread and the keyboard task. The lock is released automatically when
+ * the enclosing block goes out of scope.
+ */
+#    define rgb_matrix_lock_autounlock QMK_DECLARE_AUTOUNLOCK_CALL(rgb_matrix)
+#endif
@@ -0,0 +1,128 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/* Fake I2C master for host tests. Writes are recorded in a log instead of
+ * being sent anywhere, and queued transactions are only performed when the
+ * test steps the queue, or when the queue has to be emptied. The queue is the
+ * one the ChibiOS driver uses. */
+
+#include "i2c_master_fake.h"
+#include "i2c_async_queue.h"
+#include <stddef.h>
+#include <string.h>
+
+static i2c_fake_transaction_t i2c_log[I2C_FAKE_LOG_SIZE];
+static uint16_t               i2c_log_count = 0;
+static i2c_status_t           i2c_status    = I2C_STATUS_SUCCESS;
+
+static i2c_status_t i2c_fake_write(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length) {
+    if (i2c_log_count < I2C_FAKE_LOG_SIZE) {
+        i2c_fake_transaction_t *transaction = &i2c_log[i2c_log_count];
+        transaction->devaddr                = devaddr;
+        transaction->regaddr                = regaddr;
+        transaction->length                 = length;
+        memcpy(transaction->data, data, length < I2C_FAKE_MAX_LENGTH ? length : I2C_FAKE_MAX_LENGTH);
+    }
+    i2c_log_count++;
+    return i2c_status;
+}
+
+void i2c_fake_reset(void) {
+    i2c_async_queue_clear();
+    i2c_log_count = 0;
+    i2c_status    = I2C_STATUS_SUCCESS;
+}
+
+void i2c_fake_set_status(i2c_status_t status) {
+    i2c_status = status;
+}
+
+bool i2c_fake_step(void) {
+    i2c_async_job_t *job = i2c_async_queue_peek();
+    if (!job) {
+        return false;
+    }
+
+    i2c_status_t status = i2c_fake_write(job->devaddr, job->regaddr, i2c_async_job_data(job), job->length);
+    if (job->callback) {
+        job->callback(status, job->context);
+    }
+    i2c_async_queue_pop();
+    return true;
+}
+
+uint16_t i2c_fake_transaction_count(void) {
+    return i2c_log_count;
+}
+
+const i2c_fake_transaction_t *i2c_fake_get_transaction(uint16_t index) {
+    return index < i2c_log_count && index < I2C_FAKE_LOG_SIZE ? &i2c_log[index] : NULL;
+}
+
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout, i2c_callback_t callback, void *context) {
+    if (length > I2C_ASYNC_BUFFER_SIZE) {
+        i2c_status_t status = i2c_write_register(devaddr, regaddr, data, length, timeout);
+        if (callback) {
+            callback(status, context);
+        }
+        return status;
+    }
+
+    // Waiting for room in the queue
+    while (!i2c_async_queue_push(devaddr, regaddr, data, length, timeout, callback, context)) {
+        i2c_fake_step();
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_async_busy(void) {
+    return i2c_async_queue_count() != 0;
+}
+
+void i2c_async_wait(void) {
+    while (i2c_fake_step()) {
+    }
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
+    if (length == 0) {
+        return i2c_status;
+    }
+    return i2c_fake_write(address, data[0], data + 1, length - 1);
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
+    memset(data, 0, length);
+    return i2c_status;
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
+    return i2c_fake_write(devaddr, regaddr, data, length);
+}
+
+i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
+    return i2c_fake_write(devaddr, regaddr & 0xFF, data, length);
+}
+
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
+    memset(data, 0, length);
+    return i2c_status;
+}
+
+i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
+    memset(data, 0, length);
+    return i2c_status;
+}
+
+i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
+    i2c_async_wait();
+    return i2c_status;
+}
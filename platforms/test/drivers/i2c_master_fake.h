@@ -0,0 +1,31 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c_master.h"
+
+#define I2C_FAKE_MAX_LENGTH 32
+#define I2C_FAKE_LOG_SIZE 256
+
+/* A write performed on the fake bus. Data beyond I2C_FAKE_MAX_LENGTH is not recorded. */
+typedef struct {
+    uint8_t  devaddr;
+    uint8_t  regaddr;
+    uint16_t length;
+    uint8_t  data[I2C_FAKE_MAX_LENGTH];
+} i2c_fake_transaction_t;
+
+/* Empty the queue and the log of performed transactions. */
+void i2c_fake_reset(void);
+
+/* Set the status returned by the transactions performed from now on. */
+void i2c_fake_set_status(i2c_status_t status);
+
+/* Perform the oldest queued transaction, as the I2C thread would. Returns false if the queue is empty. */
+bool i2c_fake_step(void);
+
+uint16_t                      i2c_fake_transaction_count(void);
+const i2c_fake_transaction_t *i2c_fake_get_transaction(uint16_t index);
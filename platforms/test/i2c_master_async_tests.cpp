@@ -0,0 +1,250 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "i2c_master_fake.h"
+#include "i2c_async_queue.h"
+#include "is31fl3733.h"
+
+const is31fl3733_led_t PROGMEM g_is31fl3733_leds[IS31FL3733_LED_COUNT] = {
+    {0, SW1_CS1, SW1_CS2, SW1_CS3},
+    {0, SW2_CS1, SW2_CS2, SW2_CS3},
+};
+}
+
+#define DEVICE_ADDRESS (0x50 << 1)
+
+struct CallbackLog {
+    int          calls = 0;
+    i2c_status_t status;
+};
+
+static void callback(i2c_status_t status, void *context) {
+    CallbackLog *log = (CallbackLog *)context;
+    log->calls++;
+    log->status = status;
+}
+
+class I2CMasterAsync : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        i2c_fake_reset();
+    }
+};
+
+TEST_F(I2CMasterAsync, TransactionsArePerformedInOrder) {
+    uint8_t     data[] = {1, 2, 3, 4, 5, 6};
+    CallbackLog first, second;
+
+    EXPECT_EQ(i2c_write_register_async(DEVICE_ADDRESS, 0x10, data, sizeof(data), 100, callback, &first), I2C_STATUS_SUCCESS);
+    EXPECT_EQ(i2c_write_register_async(DEVICE_ADDRESS, 0x20, data, 2, 100, callback, &second), I2C_STATUS_SUCCESS);
+    EXPECT_TRUE(i2c_async_busy());
+    EXPECT_EQ(i2c_fake_transaction_count(), 0);
+
+    EXPECT_TRUE(i2c_fake_step());
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_EQ(first.status, I2C_STATUS_SUCCESS);
+    EXPECT_EQ(second.calls, 0);
+    EXPECT_TRUE(i2c_async_busy());
+
+    EXPECT_TRUE(i2c_fake_step());
+    EXPECT_EQ(second.calls, 1);
+    EXPECT_FALSE(i2c_async_busy());
+    EXPECT_FALSE(i2c_fake_step());
+
+    ASSERT_EQ(i2c_fake_transaction_count(), 2);
+    EXPECT_EQ(i2c_fake_get_transaction(0)->regaddr, 0x10);
+    EXPECT_EQ(i2c_fake_get_transaction(0)->length, sizeof(data));
+    EXPECT_EQ(memcmp(i2c_fake_get_transaction(0)->data, data, sizeof(data)), 0);
+    EXPECT_EQ(i2c_fake_get_transaction(1)->regaddr, 0x20);
+    EXPECT_EQ(i2c_fake_get_transaction(1)->length, 2);
+}
+
+TEST_F(I2CMasterAsync, ShortDataIsCopied) {
+    uint8_t data = 0xAA;
+    i2c_write_register_async(DEVICE_ADDRESS, 0x01, &data, 1, 100, NULL, NULL);
+    data = 0x55;
+    i2c_async_wait();
+
+    ASSERT_EQ(i2c_fake_transaction_count(), 1);
+    EXPECT_EQ(i2c_fake_get_transaction(0)->data[0], 0xAA);
+}
+
+TEST_F(I2CMasterAsync, ErrorIsPassedToCallback) {
+    uint8_t     data = 0;
+    CallbackLog log;
+
+    i2c_fake_set_status(I2C_STATUS_TIMEOUT);
+    i2c_write_register_async(DEVICE_ADDRESS, 0x01, &data, 1, 100, callback, &log);
+    i2c_async_wait();
+
+    EXPECT_EQ(log.calls, 1);
+    EXPECT_EQ(log.status, I2C_STATUS_TIMEOUT);
+}
+
+TEST_F(I2CMasterAsync, FullQueueWaitsForRoom) {
+    uint8_t data = 0;
+    for (int i = 0; i < I2C_ASYNC_QUEUE_SIZE; i++) {
+        i2c_write_register_async(DEVICE_ADDRESS, i, &data, 1, 100, NULL, NULL);
+    }
+    EXPECT_EQ(i2c_fake_transaction_count(), 0);
+
+    i2c_write_register_async(DEVICE_ADDRESS, I2C_ASYNC_QUEUE_SIZE, &data, 1, 100, NULL, NULL);
+    ASSERT_EQ(i2c_fake_transaction_count(), 1);
+    EXPECT_EQ(i2c_fake_get_transaction(0)->regaddr, 0);
+
+    i2c_async_wait();
+    ASSERT_EQ(i2c_fake_transaction_count(), I2C_ASYNC_QUEUE_SIZE + 1);
+    EXPECT_EQ(i2c_fake_get_transaction(I2C_ASYNC_QUEUE_SIZE)->regaddr, I2C_ASYNC_QUEUE_SIZE);
+}
+
+TEST_F(I2CMasterAsync, QueueRejectsPushWhenFull) {
+    uint8_t data = 0;
+    for (int i = 0; i < I2C_ASYNC_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(i2c_async_queue_push(DEVICE_ADDRESS, i, &data, 1, 100, NULL, NULL));
+    }
+    EXPECT_FALSE(i2c_async_queue_push(DEVICE_ADDRESS, 0xFF, &data, 1, 100, NULL, NULL));
+    EXPECT_EQ(i2c_async_queue_count(), I2C_ASYNC_QUEUE_SIZE);
+    EXPECT_EQ(i2c_async_queue_peek()->regaddr, 0);
+}
+
+TEST_F(I2CMasterAsync, QueueWrapsAround) {
+    uint8_t data = 0;
+    // Move the head halfway, so that later pushes wrap around the end of the storage
+    for (int i = 0; i < I2C_ASYNC_QUEUE_SIZE / 2; i++) {
+        i2c_async_queue_push(DEVICE_ADDRESS, 0xFF, &data, 1, 100, NULL, NULL);
+        i2c_async_queue_pop();
+    }
+    for (int i = 0; i < I2C_ASYNC_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(i2c_async_queue_push(DEVICE_ADDRESS, i, &data, 1, 100, NULL, NULL));
+    }
+    for (int i = 0; i < I2C_ASYNC_QUEUE_SIZE; i++) {
+        ASSERT_NE(i2c_async_queue_peek(), nullptr);
+        EXPECT_EQ(i2c_async_queue_peek()->regaddr, i);
+        i2c_async_queue_pop();
+    }
+    EXPECT_EQ(i2c_async_queue_peek(), nullptr);
+}
+
+TEST_F(I2CMasterAsync, LongDataIsCopied) {
+    uint8_t data[16];
+    memset(data, 0xAA, sizeof(data));
+    i2c_write_register_async(DEVICE_ADDRESS, 0x01, data, sizeof(data), 100, NULL, NULL);
+    memset(data, 0x55, sizeof(data));
+    i2c_async_wait();
+
+    ASSERT_EQ(i2c_fake_transaction_count(), 1);
+    EXPECT_EQ(i2c_fake_get_transaction(0)->data[0], 0xAA);
+    EXPECT_EQ(i2c_fake_get_transaction(0)->data[15], 0xAA);
+}
+
+TEST_F(I2CMasterAsync, QueueRejectsPushWhenBufferIsFull) {
+    uint8_t data[I2C_ASYNC_BUFFER_SIZE / 2] = {0};
+    EXPECT_TRUE(i2c_async_queue_push(DEVICE_ADDRESS, 0x01, data, sizeof(data), 100, NULL, NULL));
+    EXPECT_TRUE(i2c_async_queue_push(DEVICE_ADDRESS, 0x02, data, sizeof(data), 100, NULL, NULL));
+    EXPECT_FALSE(i2c_async_queue_push(DEVICE_ADDRESS, 0x03, data, 1, 100, NULL, NULL));
+
+    i2c_async_queue_pop();
+    EXPECT_TRUE(i2c_async_queue_push(DEVICE_ADDRESS, 0x03, data, 1, 100, NULL, NULL));
+}
+
+TEST_F(I2CMasterAsync, QueueDataIsNotSplitAtTheEndOfTheBuffer) {
+    uint8_t first[I2C_ASYNC_BUFFER_SIZE / 2 + 1];
+    uint8_t second[I2C_ASYNC_BUFFER_SIZE / 2];
+    memset(first, 1, sizeof(first));
+    memset(second, 2, sizeof(second));
+    EXPECT_TRUE(i2c_async_queue_push(DEVICE_ADDRESS, 0x01, first, sizeof(first), 100, NULL, NULL));
+    EXPECT_TRUE(i2c_async_queue_push(DEVICE_ADDRESS, 0x02, first, 1, 100, NULL, NULL));
+
+    // Too few bytes are left at the end of the buffer, so the data goes at its start
+    i2c_async_queue_pop();
+    EXPECT_TRUE(i2c_async_queue_push(DEVICE_ADDRESS, 0x03, second, sizeof(second), 100, NULL, NULL));
+
+    i2c_async_job_t *job = i2c_async_queue_peek();
+    EXPECT_EQ(job->regaddr, 0x02);
+    EXPECT_EQ(i2c_async_job_data(job)[0], 1);
+    i2c_async_queue_pop();
+
+    job = i2c_async_queue_peek();
+    EXPECT_EQ(job->regaddr, 0x03);
+    EXPECT_EQ(memcmp(i2c_async_job_data(job), second, sizeof(second)), 0);
+}
+
+TEST_F(I2CMasterAsync, DataLongerThanTheBufferIsWrittenSynchronously) {
+    uint8_t     data[I2C_ASYNC_BUFFER_SIZE + 1] = {0};
+    uint8_t     other                           = 0;
+    CallbackLog log;
+    i2c_write_register_async(DEVICE_ADDRESS, 0x01, &other, 1, 100, NULL, NULL);
+    EXPECT_EQ(i2c_write_register_async(DEVICE_ADDRESS, 0x02, data, sizeof(data), 100, callback, &log), I2C_STATUS_SUCCESS);
+
+    EXPECT_FALSE(i2c_async_busy());
+    EXPECT_EQ(log.calls, 1);
+    ASSERT_EQ(i2c_fake_transaction_count(), 2);
+    EXPECT_EQ(i2c_fake_get_transaction(0)->regaddr, 0x01);
+    EXPECT_EQ(i2c_fake_get_transaction(1)->regaddr, 0x02);
+}
+
+TEST_F(I2CMasterAsync, SynchronousWriteWaitsForQueue) {
+    uint8_t data = 0;
+    i2c_write_register_async(DEVICE_ADDRESS, 0x01, &data, 1, 100, NULL, NULL);
+    i2c_write_register_async(DEVICE_ADDRESS, 0x02, &data, 1, 100, NULL, NULL);
+    i2c_write_register(DEVICE_ADDRESS, 0x03, &data, 1, 100);
+
+    EXPECT_FALSE(i2c_async_busy());
+    ASSERT_EQ(i2c_fake_transaction_count(), 3);
+    EXPECT_EQ(i2c_fake_get_transaction(0)->regaddr, 0x01);
+    EXPECT_EQ(i2c_fake_get_transaction(1)->regaddr, 0x02);
+    EXPECT_EQ(i2c_fake_get_transaction(2)->regaddr, 0x03);
+}
+
+TEST_F(I2CMasterAsync, LedDriverFrameIsQueued) {
+    is31fl3733_init_drivers();
+    i2c_async_wait();
+    i2c_fake_reset();
+
+    is31fl3733_set_color(1, 0x11, 0x22, 0x33);
+    is31fl3733_flush();
+
+    // Nothing is sent until the I2C thread gets to it
+    EXPECT_TRUE(i2c_async_busy());
+    EXPECT_EQ(i2c_fake_transaction_count(), 0);
+
+    i2c_async_wait();
+
+    // Page select, then only the 16 byte chunk of PWM registers which changed
+    ASSERT_EQ(i2c_fake_transaction_count(), 2 + 1);
+    EXPECT_EQ(i2c_fake_get_transaction(0)->regaddr, IS31FL3733_REG_COMMAND_WRITE_LOCK);
+    EXPECT_EQ(i2c_fake_get_transaction(1)->regaddr, IS31FL3733_REG_COMMAND);
+    EXPECT_EQ(i2c_fake_get_transaction(1)->data[0], IS31FL3733_COMMAND_PWM);
+    const i2c_fake_transaction_t *chunk = i2c_fake_get_transaction(2);
+    EXPECT_EQ(chunk->regaddr, SW2_CS1 / 16 * 16);
+    EXPECT_EQ(chunk->length, 16);
+    EXPECT_EQ(chunk->data[SW2_CS1 % 16], 0x11);
+    EXPECT_EQ(chunk->data[SW2_CS2 % 16], 0x22);
+    EXPECT_EQ(chunk->data[SW2_CS3 % 16], 0x33);
+    EXPECT_EQ(is31fl3733_get_pwm_bytes_sent(), 16);
+
+    // Nothing to send when the buffer is unchanged
+    is31fl3733_flush();
+    EXPECT_FALSE(i2c_async_busy());
+    EXPECT_EQ(i2c_fake_transaction_count(), 2 + 1);
+    EXPECT_EQ(is31fl3733_get_pwm_bytes_sent(), 0);
+}
+
+TEST_F(I2CMasterAsync, LedDriverSendsEveryChangedChunk) {
+    is31fl3733_init_drivers();
+    i2c_async_wait();
+    i2c_fake_reset();
+
+    // The two LEDs are on different rows, 16 registers apart
+    is31fl3733_set_color_all(0x40, 0x40, 0x40);
+    is31fl3733_flush();
+    i2c_async_wait();
+
+    ASSERT_EQ(i2c_fake_transaction_count(), 2 + 2);
+    EXPECT_EQ(i2c_fake_get_transaction(2)->regaddr, SW1_CS1);
+    EXPECT_EQ(i2c_fake_get_transaction(3)->regaddr, SW2_CS1);
+    EXPECT_EQ(is31fl3733_get_pwm_bytes_sent(), 32);
+}
@@ -23,3 +23,21 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+i2c_master_async_DEFS := \
+	-DI2C_ASYNC_ENABLE \
+	-DI2C_ASYNC_QUEUE_SIZE=16 \
+	-DI2C_ASYNC_BUFFER_SIZE=64 \
+	-DIS31FL3733_I2C_ADDRESS_1=0x50 \
+	-DIS31FL3733_LED_COUNT=2
+
+i2c_master_async_INC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers \
+	$(DRIVER_PATH)/led/issi
+
+i2c_master_async_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/i2c_master_async_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/i2c_master.c \
+	$(DRIVER_PATH)/i2c_async_queue.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(DRIVER_PATH)/led/issi/is31fl3733.c
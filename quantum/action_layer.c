@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -39,6 +40,7 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_state = state;
     default_layer_debug();
     ac_dprintf("\n");
+    effective_layer_cache_invalidate();
 #if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -119,6 +121,7 @@ void layer_state_set(layer_state_t state) {
     layer_state = state;
     layer_debug();
     ac_dprintf("\n");
+    effective_layer_cache_invalidate();
 #    if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #    elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -316,11 +319,30 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#if !defined(NO_ACTION_LAYER) && defined(EFFECTIVE_LAYER_CACHE_ENABLE)
+/** \brief effective layer cache
  *
- * Gets the layer based on key info
+ * Resolved (topmost non-transparent) layer per matrix position. Entries are
+ * filled lazily and the whole table is invalidated on layer or keymap changes.
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
+static uint8_t effective_layer_cache[MATRIX_ROWS * MATRIX_COLS];
+static uint8_t effective_layer_cache_valid[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)];
+
+/** \brief effective layer cache invalidate
+ *
+ * Must be called whenever the result of layer_switch_get_layer() may change,
+ * i.e. on layer state or keymap changes.
+ */
+void effective_layer_cache_invalidate(void) {
+    memset(effective_layer_cache_valid, 0, sizeof(effective_layer_cache_valid));
+}
+#endif
+
+/** \brief Layer switch resolve layer
+ *
+ * Walks the active layers from the top down and returns the first one with a non-transparent action
+ */
+static uint8_t layer_switch_resolve_layer(keypos_t key) {
 #ifndef NO_ACTION_LAYER
     action_t action;
     action.code = ACTION_TRANSPARENT;
@@ -342,6 +364,27 @@ uint8_t layer_switch_get_layer(keypos_t key) {
 #endif
 }
 
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#if !defined(NO_ACTION_LAYER) && defined(EFFECTIVE_LAYER_CACHE_ENABLE)
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        const uint16_t entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
+        const uint16_t storage_idx  = entry_number / (CHAR_BIT);
+        const uint8_t  storage_bit  = entry_number % (CHAR_BIT);
+
+        if (!(effective_layer_cache_valid[storage_idx] & (1U << storage_bit))) {
+            effective_layer_cache[entry_number] = layer_switch_resolve_layer(key);
+            effective_layer_cache_valid[storage_idx] |= (1U << storage_bit);
+        }
+        return effective_layer_cache[entry_number];
+    }
+#endif
+    return layer_switch_resolve_layer(key);
+}
+
 /** \brief Layer switch get layer
  *
  * Gets action code based on key position
@@ -166,5 +166,12 @@ action_t store_or_get_action(bool pressed, keypos_t key);
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
+#if !defined(NO_ACTION_LAYER) && defined(EFFECTIVE_LAYER_CACHE_ENABLE)
+/* invalidate the per-key resolved layer table used by layer_switch_get_layer() */
+void effective_layer_cache_invalidate(void);
+#else
+#    define effective_layer_cache_invalidate()
+#endif
+
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
@@ -5,6 +5,7 @@
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "keycode.h"
+#include "keyrecord_queue.h"
 #include "timer.h"
 
 #ifndef NO_ACTION_TAPPING
@@ -98,13 +99,13 @@ __attribute__((weak)) bool get_hold_on_other_key_press(uint16_t keycode, keyreco
 #        include "process_auto_shift.h"
 #    endif
 
-static keyrecord_t tapping_key                         = {};
-static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
-static uint8_t     waiting_buffer_head                 = 0;
-static uint8_t     waiting_buffer_tail                 = 0;
+static keyrecord_t tapping_key = {};
+// WAITING_BUFFER_SIZE - 1 records, as many as the waiting buffer has always held
+static keyrecord_t       waiting_buffer_records[WAITING_BUFFER_SIZE - 1] = {};
+static keyrecord_queue_t waiting_buffer                                  = KEYRECORD_QUEUE(waiting_buffer_records);
 
 static bool process_tapping(keyrecord_t *record);
-static bool waiting_buffer_enq(keyrecord_t record);
+static bool waiting_buffer_enq(keyrecord_t *record);
 static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
@@ -124,7 +125,7 @@ void action_tapping_process(keyrecord_t record) {
             ac_dprintf("\n");
         }
     } else {
-        if (!waiting_buffer_enq(record)) {
+        if (!waiting_buffer_enq(&record)) {
             // clear all in case of overflow.
             ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
             clear_keyboard();
@@ -134,14 +135,16 @@ void action_tapping_process(keyrecord_t record) {
     }
 
     // process waiting_buffer
-    if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
+    if (IS_EVENT(record.event) && !keyrecord_queue_is_empty(&waiting_buffer)) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
-        if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
-            ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
-            debug_record(waiting_buffer[waiting_buffer_tail]);
+    while (!keyrecord_queue_is_empty(&waiting_buffer)) {
+        keyrecord_t *waiting = keyrecord_queue_get(&waiting_buffer, 0);
+        if (process_tapping(waiting)) {
+            ac_dprintf("processed: waiting_buffer[0] =");
+            debug_record(*waiting);
             ac_dprintf("\n\n");
+            keyrecord_queue_drop(&waiting_buffer, 1);
         } else {
             break;
         }
@@ -307,9 +310,10 @@ bool process_tapping(keyrecord_t *keyp) {
                     uint8_t first_tap = waiting_buffer_find_chordal_hold_tap();
                     ac_dprintf("first_tap = %u\n", first_tap);
                     if (first_tap < WAITING_BUFFER_SIZE) {
-                        for (; waiting_buffer_tail != first_tap; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
-                            ac_dprintf("Processing [%u]\n", waiting_buffer_tail);
-                            process_record(&waiting_buffer[waiting_buffer_tail]);
+                        for (; first_tap > 0; first_tap--) {
+                            ac_dprintf("Processing [0]\n");
+                            process_record(keyrecord_queue_get(&waiting_buffer, 0));
+                            keyrecord_queue_drop(&waiting_buffer, 1);
                         }
                     }
 
@@ -404,10 +408,10 @@ bool process_tapping(keyrecord_t *keyp) {
                             process_record(&tapping_key);
 
 #    if defined(CHORDAL_HOLD)
-                            if (waiting_buffer_tail != waiting_buffer_head && is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
-                                tapping_key = waiting_buffer[waiting_buffer_tail];
+                            if (!keyrecord_queue_is_empty(&waiting_buffer) && is_tap_record(keyrecord_queue_get(&waiting_buffer, 0))) {
+                                tapping_key = *keyrecord_queue_get(&waiting_buffer, 0);
                                 // Pop tail from the queue.
-                                waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+                                keyrecord_queue_drop(&waiting_buffer, 1);
                                 debug_waiting_buffer();
                             } else
 #    endif // CHORDAL_HOLD
@@ -571,18 +575,17 @@ bool process_tapping(keyrecord_t *keyp) {
  *
  * FIXME: Needs docs
  */
-bool waiting_buffer_enq(keyrecord_t record) {
-    if (IS_NOEVENT(record.event)) {
+bool waiting_buffer_enq(keyrecord_t *record) {
+    if (IS_NOEVENT(record->event)) {
         return true;
     }
 
-    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+    keyrecord_t *queued = keyrecord_queue_push(&waiting_buffer);
+    if (queued == NULL) {
         ac_dprintf("waiting_buffer_enq: Over flow.\n");
         return false;
     }
-
-    waiting_buffer[waiting_buffer_head] = record;
-    waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    *queued = *record;
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
@@ -594,8 +597,7 @@ bool waiting_buffer_enq(keyrecord_t record) {
  * FIXME: Needs docs
  */
 void waiting_buffer_clear(void) {
-    waiting_buffer_head = 0;
-    waiting_buffer_tail = 0;
+    keyrecord_queue_clear(&waiting_buffer);
 }
 
 /** \brief Waiting buffer typed
@@ -603,8 +605,9 @@ void waiting_buffer_clear(void) {
  * FIXME: Needs docs
  */
 bool waiting_buffer_typed(keyevent_t event) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
+    for (uint8_t i = 0; i < keyrecord_queue_count(&waiting_buffer); i++) {
+        keyrecord_t *waiting = keyrecord_queue_get(&waiting_buffer, i);
+        if (KEYEQ(event.key, waiting->event.key) && event.pressed != waiting->event.pressed) {
             return true;
         }
     }
@@ -616,8 +619,8 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
+    for (uint8_t i = 0; i < keyrecord_queue_count(&waiting_buffer); i++) {
+        if (keyrecord_queue_get(&waiting_buffer, i)->event.pressed) return true;
     }
     return false;
 }
@@ -637,11 +640,11 @@ void waiting_buffer_scan_tap(void) {
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
 #    endif
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        keyrecord_t *candidate = &waiting_buffer[i];
+    for (uint8_t i = 0; i < keyrecord_queue_count(&waiting_buffer); i++) {
+        keyrecord_t *candidate = keyrecord_queue_get(&waiting_buffer, i);
         // clang-format off
         if (IS_EVENT(candidate->event) && KEYEQ(candidate->event.key, tapping_key.event.key) && !candidate->event.pressed && (
-            WITHIN_TAPPING_TERM(waiting_buffer[i].event) || MAYBE_RETRO_SHIFTING(waiting_buffer[i].event, &tapping_key)
+            WITHIN_TAPPING_TERM(candidate->event) || MAYBE_RETRO_SHIFTING(candidate->event, &tapping_key)
         )) {
             // clang-format on
             tapping_key.tap.count = 1;
@@ -718,8 +721,8 @@ static uint8_t waiting_buffer_find_chordal_hold_tap(void) {
     keyrecord_t *prev         = &tapping_key;
     uint16_t     prev_keycode = get_record_keycode(&tapping_key, false);
     uint8_t      first_tap    = WAITING_BUFFER_SIZE;
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        keyrecord_t *  cur         = &waiting_buffer[i];
+    for (uint8_t i = 0; i < keyrecord_queue_count(&waiting_buffer); i++) {
+        keyrecord_t *  cur         = keyrecord_queue_get(&waiting_buffer, i);
         const uint16_t cur_keycode = get_record_keycode(cur, false);
         if (!cur->event.pressed || !is_mt_or_lt(prev_keycode)) {
             break;
@@ -733,15 +736,15 @@ static uint8_t waiting_buffer_find_chordal_hold_tap(void) {
 }
 
 static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
-    while (waiting_buffer_tail != waiting_buffer_head) {
-        keyrecord_t *record = &waiting_buffer[waiting_buffer_tail];
-        ac_dprintf("waiting_buffer_chordal_hold_taps_until: processing [%u]\n", waiting_buffer_tail);
+    while (!keyrecord_queue_is_empty(&waiting_buffer)) {
+        keyrecord_t *record = keyrecord_queue_get(&waiting_buffer, 0);
+        ac_dprintf("waiting_buffer_chordal_hold_taps_until: processing [0]\n");
         if (record->event.pressed && is_tap_record(record)) {
             record->tap.count = 1;
             registered_taps_add(record->event.key);
         }
         process_record(record);
-        waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        keyrecord_queue_drop(&waiting_buffer, 1);
 
         if (KEYEQ(key, record->event.key) && record->event.pressed) {
             break;
@@ -750,12 +753,14 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
 }
 
 static void waiting_buffer_process_regular(void) {
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
-        if (is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
+    while (!keyrecord_queue_is_empty(&waiting_buffer)) {
+        keyrecord_t *record = keyrecord_queue_get(&waiting_buffer, 0);
+        if (is_tap_record(record)) {
             break; // Stop once a tap-hold key event is reached.
         }
-        ac_dprintf("waiting_buffer_process_regular: processing [%u]\n", waiting_buffer_tail);
-        process_record(&waiting_buffer[waiting_buffer_tail]);
+        ac_dprintf("waiting_buffer_process_regular: processing [0]\n");
+        process_record(record);
+        keyrecord_queue_drop(&waiting_buffer, 1);
     }
     debug_waiting_buffer();
 }
@@ -771,9 +776,9 @@ static void debug_tapping_key(void) {
 /** \brief Logs waiting buffer if ACTION_DEBUG is enabled. */
 static void debug_waiting_buffer(void) {
     ac_dprintf("{");
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = 0; i < keyrecord_queue_count(&waiting_buffer); i++) {
         ac_dprintf(" [%u]=", i);
-        debug_record(waiting_buffer[i]);
+        debug_record(*keyrecord_queue_get(&waiting_buffer, i));
     }
     ac_dprintf("}\n");
 }
@@ -283,33 +283,155 @@ static uint8_t get_mods_for_report(void) {
     return mods;
 }
 
-void send_6kro_report(void) {
-    keyboard_report->mods = get_mods_for_report();
+#ifndef PROTOCOL_VUSB
+static report_keyboard_t last_6kro_report;
+#endif
+#ifdef NKRO_ENABLE
+static report_nkro_t last_nkro_report;
+#endif
+
+#ifdef KEYBOARD_REPORT_BATCHING
+#    ifdef PROTOCOL_VUSB
+#        error "KEYBOARD_REPORT_BATCHING is not supported with V-USB"
+#    endif
 
+static bool              batching            = false;
+static bool              pending_6kro        = false;
+static report_keyboard_t pending_6kro_report = {};
+#    ifdef NKRO_ENABLE
+static bool          pending_nkro        = false;
+static report_nkro_t pending_nkro_report = {};
+#    endif
+#endif
+
+/* Only send the report if there are changes to propagate to the host. */
+static void flush_6kro_report(report_keyboard_t *report) {
 #ifdef PROTOCOL_VUSB
-    host_keyboard_send(keyboard_report);
+    host_keyboard_send(report);
 #else
-    static report_keyboard_t last_report;
+    if (memcmp(report, &last_6kro_report, sizeof(report_keyboard_t)) != 0) {
+        memcpy(&last_6kro_report, report, sizeof(report_keyboard_t));
+        host_keyboard_send(report);
+    }
+#endif
+}
 
-    /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(keyboard_report, &last_report, sizeof(report_keyboard_t)) != 0) {
-        memcpy(&last_report, keyboard_report, sizeof(report_keyboard_t));
-        host_keyboard_send(keyboard_report);
+#ifdef NKRO_ENABLE
+static void flush_nkro_report(report_nkro_t *report) {
+    if (memcmp(report, &last_nkro_report, sizeof(report_nkro_t)) != 0) {
+        memcpy(&last_nkro_report, report, sizeof(report_nkro_t));
+        host_nkro_send(report);
     }
+}
 #endif
+
+#ifdef KEYBOARD_REPORT_BATCHING
+static bool has_6kro_key(report_keyboard_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* A key which changed from the sent report to the pending one and then back again,
+ * e.g. a tap within a single scan. Merging the reports would lose it entirely. */
+static bool is_6kro_changed_back(report_keyboard_t *sent, report_keyboard_t *pending, report_keyboard_t *next) {
+    if ((sent->mods ^ pending->mods) & (pending->mods ^ next->mods)) {
+        return true;
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = pending->keys[i];
+        if (key && !has_6kro_key(sent, key) && !has_6kro_key(next, key)) {
+            return true;
+        }
+        key = sent->keys[i];
+        if (key && !has_6kro_key(pending, key) && has_6kro_key(next, key)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#    ifdef NKRO_ENABLE
+static bool is_nkro_changed_back(report_nkro_t *sent, report_nkro_t *pending, report_nkro_t *next) {
+    if ((sent->mods ^ pending->mods) & (pending->mods ^ next->mods)) {
+        return true;
+    }
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        if ((sent->bits[i] ^ pending->bits[i]) & (pending->bits[i] ^ next->bits[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+#    endif
+
+/** \brief Begin batching keyboard reports
+ *
+ * Until end_keyboard_report_batch() is called, keyboard reports are merged and only
+ * the last one is sent. A key which is pressed and released again within the batch
+ * still gets a report for each change, so no key event is ever lost.
+ */
+void begin_keyboard_report_batch(void) {
+    batching = true;
+}
+
+/** \brief End batching keyboard reports
+ *
+ * Sends the merged report, if any. Reports are sent immediately again afterwards.
+ */
+void end_keyboard_report_batch(void) {
+    batching = false;
+
+    if (pending_6kro) {
+        pending_6kro = false;
+        flush_6kro_report(&pending_6kro_report);
+    }
+#    ifdef NKRO_ENABLE
+    if (pending_nkro) {
+        pending_nkro = false;
+        flush_nkro_report(&pending_nkro_report);
+    }
+#    endif
+}
+#endif
+
+void send_6kro_report(void) {
+    keyboard_report->mods = get_mods_for_report();
+
+#ifdef KEYBOARD_REPORT_BATCHING
+    if (batching) {
+        if (pending_6kro && is_6kro_changed_back(&last_6kro_report, &pending_6kro_report, keyboard_report)) {
+            flush_6kro_report(&pending_6kro_report);
+        }
+        // Keep a copy, as the mods for the report can't be recalculated (one shot mods are cleared)
+        memcpy(&pending_6kro_report, keyboard_report, sizeof(report_keyboard_t));
+        pending_6kro = true;
+        return;
+    }
+#endif
+
+    flush_6kro_report(keyboard_report);
 }
 
 #ifdef NKRO_ENABLE
 void send_nkro_report(void) {
     nkro_report->mods = get_mods_for_report();
 
-    static report_nkro_t last_report;
-
-    /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(nkro_report, &last_report, sizeof(report_nkro_t)) != 0) {
-        memcpy(&last_report, nkro_report, sizeof(report_nkro_t));
-        host_nkro_send(nkro_report);
+#    ifdef KEYBOARD_REPORT_BATCHING
+    if (batching) {
+        if (pending_nkro && is_nkro_changed_back(&last_nkro_report, &pending_nkro_report, nkro_report)) {
+            flush_nkro_report(&pending_nkro_report);
+        }
+        memcpy(&pending_nkro_report, nkro_report, sizeof(report_nkro_t));
+        pending_nkro = true;
+        return;
     }
+#    endif
+
+    flush_nkro_report(nkro_report);
 }
 #endif
 
@@ -32,6 +32,14 @@ extern report_nkro_t *nkro_report;
 
 void send_keyboard_report(void);
 
+#ifdef KEYBOARD_REPORT_BATCHING
+void begin_keyboard_report_batch(void);
+void end_keyboard_report_batch(void);
+#else
+#    define begin_keyboard_report_batch()
+#    define end_keyboard_report_batch()
+#endif
+
 /* key */
 inline void add_key(uint8_t key) {
     add_key_to_report(key);
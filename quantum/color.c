@@ -108,3 +108,66 @@ rgb_t hsv_to_rgb(hsv_t hsv) {
 rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
+
+// clang-format off
+// h * 6 / 255 for every hue
+static const uint8_t hue_region[256] PROGMEM = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6
+};
+// clang-format on
+
+// Channel order for every region, as indexes into { v, p, q, t }
+static const uint8_t region_channels[7][3] PROGMEM = {
+    {0, 3, 1}, {2, 0, 1}, {1, 0, 3}, {1, 2, 0}, {3, 1, 0}, {0, 1, 2}, {0, 3, 1},
+};
+
+void hsv_to_rgb_many(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    // s and v rarely change within a batch, so only redo their part on changes
+    uint8_t last_s    = 0, last_v = 0;
+    uint8_t values[4] = {0}; // v, p, q, t
+
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t s = hsv[i].s;
+
+        if (i == 0 || s != last_s || hsv[i].v != last_v) {
+            last_s = s;
+            last_v = hsv[i].v;
+#ifdef USE_CIE1931_CURVE
+            values[0] = pgm_read_byte(&CIE1931_CURVE[last_v]);
+#else
+            values[0] = last_v;
+#endif
+            values[1] = (values[0] * (255 - s)) >> 8;
+        }
+
+        if (s == 0) {
+            rgb[i].r = rgb[i].g = rgb[i].b = values[0];
+            continue;
+        }
+
+        uint8_t region    = pgm_read_byte(&hue_region[hsv[i].h]);
+        uint8_t remainder = (hsv[i].h * 2 - region * 85) * 3;
+
+        values[2] = (values[0] * (255 - ((s * remainder) >> 8))) >> 8;
+        values[3] = (values[0] * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+        rgb[i].r = values[pgm_read_byte(&region_channels[region][0])];
+        rgb[i].g = values[pgm_read_byte(&region_channels[region][1])];
+        rgb[i].b = values[pgm_read_byte(&region_channels[region][2])];
+    }
+}
@@ -95,3 +95,6 @@ typedef hsv_t HSV;
 
 rgb_t hsv_to_rgb(hsv_t hsv);
 rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+
+// Same as hsv_to_rgb() for every element, but faster for many LEDs at once
+void hsv_to_rgb_many(const hsv_t *hsv, rgb_t *rgb, uint8_t count);
@@ -18,4 +18,15 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 
 void debounce_init(uint8_t num_rows);
 
+/**
+ * @brief Get the time at which the last change of a key was detected, for debounce algorithms which record it.
+ *
+ * @param row The row, relative to the rows passed to debounce()
+ * @param col The column
+ * @param time_us Receives the time of the change, as returned by timer_read_us()
+ * @return true The time of the change is known
+ * @return false The debounce algorithm does not record the time of changes
+ */
+bool debounce_get_edge_time(uint8_t row, uint8_t col, uint32_t *time_us);
+
 void debounce_free(void);
@@ -0,0 +1,174 @@
+/*
+Copyright 2026 QMK
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Symmetric per-key algorithm with bit-sliced counters. Behaves the same as sym_defer_pk,
+but instead of a byte per key, bit n of the counters of every key in a row is stored in
+a single matrix_row_t. All keys of a row are then counted down at once with a handful of
+bitwise operations per bit, without any per-key branches.
+When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <stdlib.h>
+
+#ifdef PROTOCOL_CHIBIOS
+#    if CH_CFG_USE_MEMCORE == FALSE
+#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    endif
+#endif
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+// Number of bits needed to hold DEBOUNCE
+#if DEBOUNCE < 2
+#    define DEBOUNCE_BITS 1
+#elif DEBOUNCE < 4
+#    define DEBOUNCE_BITS 2
+#elif DEBOUNCE < 8
+#    define DEBOUNCE_BITS 3
+#elif DEBOUNCE < 16
+#    define DEBOUNCE_BITS 4
+#elif DEBOUNCE < 32
+#    define DEBOUNCE_BITS 5
+#elif DEBOUNCE < 64
+#    define DEBOUNCE_BITS 6
+#elif DEBOUNCE < 128
+#    define DEBOUNCE_BITS 7
+#else
+#    define DEBOUNCE_BITS 8
+#endif
+
+#if DEBOUNCE > 0
+// num_rows * DEBOUNCE_BITS bit planes, least significant bit first
+static matrix_row_t *debounce_planes;
+static fast_timer_t  last_time;
+static bool          counters_need_update;
+static bool          cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    debounce_planes = (matrix_row_t *)calloc(num_rows * DEBOUNCE_BITS, sizeof(matrix_row_t));
+}
+
+void debounce_free(void) {
+    free(debounce_planes);
+    debounce_planes = NULL;
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        // Every counter expires after DEBOUNCE, so this fits in the bit planes
+        if (elapsed_time > DEBOUNCE) {
+            elapsed_time = DEBOUNCE;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    matrix_row_t *planes = debounce_planes;
+    for (uint8_t row = 0; row < num_rows; row++, planes += DEBOUNCE_BITS) {
+        matrix_row_t active    = 0;
+        matrix_row_t remaining = 0;
+        matrix_row_t borrow    = 0;
+
+        // Ripple-borrow subtraction of elapsed_time from every counter in the row
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            matrix_row_t counter = planes[bit];
+            matrix_row_t elapsed = (elapsed_time & (1 << bit)) ? ~(matrix_row_t)0 : 0;
+
+            planes[bit] = counter ^ elapsed ^ borrow;
+            borrow      = (~counter & (elapsed | borrow)) | (elapsed & borrow);
+            active |= counter;
+            remaining |= planes[bit];
+        }
+
+        // Counters which reached or went below zero have expired
+        matrix_row_t expired = active & (borrow | ~remaining);
+        matrix_row_t running = active & ~expired;
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            planes[bit] &= running;
+        }
+
+        if (running) {
+            counters_need_update = true;
+        }
+
+        if (expired) {
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    matrix_row_t *planes = debounce_planes;
+    for (uint8_t row = 0; row < num_rows; row++, planes += DEBOUNCE_BITS) {
+        matrix_row_t delta  = raw[row] ^ cooked[row];
+        matrix_row_t active = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            active |= planes[bit];
+        }
+
+        // Keys which changed start counting, keys which changed back are stopped
+        matrix_row_t start = delta & ~active;
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            planes[bit] = (planes[bit] & delta) | ((DEBOUNCE & (1 << bit)) ? start : 0);
+        }
+
+        if (start) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,144 @@
+/*
+Copyright 2026 QMK
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Symmetric per-key algorithm with microsecond timestamps. Behaves the same as sym_defer_pk,
+but records the time of the edge of every key with timer_read_us(), instead of counting
+down whole milliseconds of scan time. The recorded edge time is also used for the time of
+the key event.
+When no state changes have occured for DEBOUNCE_US microseconds, we push the state.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <stdlib.h>
+
+#ifdef PROTOCOL_CHIBIOS
+#    if CH_CFG_USE_MEMCORE == FALSE
+#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    endif
+#endif
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+#ifndef DEBOUNCE_US
+#    define DEBOUNCE_US (DEBOUNCE * 1000UL)
+#endif
+
+#if DEBOUNCE_US > 0
+static uint32_t     *edge_times;
+static matrix_row_t *debouncing_keys;
+static uint8_t       debounce_rows;
+static bool          counters_need_update;
+static bool          cooked_changed;
+
+static void transfer_expired_keys(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t now);
+static void start_debounce_timers(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t now);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    edge_times      = (uint32_t *)calloc(num_rows * MATRIX_COLS, sizeof(uint32_t));
+    debouncing_keys = (matrix_row_t *)calloc(num_rows, sizeof(matrix_row_t));
+    debounce_rows   = num_rows;
+}
+
+void debounce_free(void) {
+    free(edge_times);
+    edge_times = NULL;
+    free(debouncing_keys);
+    debouncing_keys = NULL;
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    cooked_changed = false;
+
+    if (!counters_need_update && !changed) {
+        return false;
+    }
+
+    uint32_t now = timer_read_us();
+
+    if (counters_need_update) {
+        transfer_expired_keys(raw, cooked, num_rows, now);
+    }
+
+    if (changed) {
+        start_debounce_timers(raw, cooked, num_rows, now);
+    }
+
+    return cooked_changed;
+}
+
+bool debounce_get_edge_time(uint8_t row, uint8_t col, uint32_t *time_us) {
+    if (edge_times == NULL || row >= debounce_rows || col >= MATRIX_COLS) {
+        return false;
+    }
+    *time_us = edge_times[row * MATRIX_COLS + col];
+    return true;
+}
+
+static void transfer_expired_keys(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t now) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        if (!debouncing_keys[row]) {
+            continue;
+        }
+
+        uint32_t    *edge_time = &edge_times[row * MATRIX_COLS];
+        matrix_row_t expired   = 0;
+        matrix_row_t col_mask  = 1;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
+            if (debouncing_keys[row] & col_mask) {
+                if (TIMER_DIFF_32(now, edge_time[col]) >= DEBOUNCE_US) {
+                    expired |= col_mask;
+                } else {
+                    counters_need_update = true;
+                }
+            }
+        }
+
+        if (expired) {
+            debouncing_keys[row] &= ~expired;
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+    }
+}
+
+static void start_debounce_timers(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t now) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t delta = raw[row] ^ cooked[row];
+        // Keys which changed back are stopped, keys which changed record the time of the edge
+        matrix_row_t started = delta & ~debouncing_keys[row];
+        debouncing_keys[row] = delta;
+
+        if (started) {
+            uint32_t    *edge_time = &edge_times[row * MATRIX_COLS];
+            matrix_row_t col_mask  = 1;
+            for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
+                if (started & col_mask) {
+                    edge_time[col] = now;
+                }
+            }
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,126 @@
+/* Copyright 2026 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host-side benchmark of a single debounce algorithm, built once per algorithm
+ * and matrix size (see rules.mk). Run all of them with:
+ *
+ *     make test:debounce_benchmark
+ *
+ * The cost per scan is printed; cycles are only available on x86 hosts.
+ */
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#    define DEBOUNCE_BENCHMARK_CYCLES() __rdtsc()
+#endif
+
+extern "C" {
+#include "debounce.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define DEBOUNCE_BENCHMARK_STR_(x) #x
+#define DEBOUNCE_BENCHMARK_STR(x) DEBOUNCE_BENCHMARK_STR_(x)
+
+/* Matrix scans per simulated millisecond */
+#define SCANS_PER_MS 4
+/* Total number of scans */
+#define SCANS 200000
+
+class DebounceBenchmark : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        std::fill(std::begin(raw_), std::end(raw_), 0);
+        std::fill(std::begin(cooked_), std::end(cooked_), 0);
+        set_time(7777);
+        debounce_init(MATRIX_ROWS);
+    }
+
+    void TearDown() override {
+        debounce_free();
+    }
+
+    /* Typing with contact bounce: every 20ms a key toggles, bouncing back and forth for 2ms. */
+    bool nextScan(uint32_t scan) {
+        uint32_t ms    = scan / SCANS_PER_MS;
+        bool     first = (scan % SCANS_PER_MS) == 0;
+
+        if (!first || (ms % 20) > 2) {
+            return false;
+        }
+
+        if ((ms % 20) == 0) {
+            seed_ = seed_ * 1103515245 + 12345;
+            row_  = (seed_ >> 16) % MATRIX_ROWS;
+            col_  = (seed_ >> 8) % MATRIX_COLS;
+        }
+        raw_[row_] ^= ((matrix_row_t)1 << col_);
+        return true;
+    }
+
+    matrix_row_t raw_[MATRIX_ROWS];
+    matrix_row_t cooked_[MATRIX_ROWS];
+
+   private:
+    uint32_t seed_ = 1;
+    uint8_t  row_  = 0;
+    uint8_t  col_  = 0;
+};
+
+TEST_F(DebounceBenchmark, ScanCost) {
+    uint64_t cycles  = 0;
+    uint32_t changes = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t scan = 0; scan < SCANS; scan++) {
+        bool changed = nextScan(scan);
+#ifdef DEBOUNCE_BENCHMARK_CYCLES
+        uint64_t begin = DEBOUNCE_BENCHMARK_CYCLES();
+        changes += debounce(raw_, cooked_, MATRIX_ROWS, changed);
+        cycles += DEBOUNCE_BENCHMARK_CYCLES() - begin;
+#else
+        changes += debounce(raw_, cooked_, MATRIX_ROWS, changed);
+#endif
+        if ((scan % SCANS_PER_MS) == SCANS_PER_MS - 1) {
+            advance_time(1);
+        }
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    /* Let everything settle, the cooked matrix has to end up matching the raw one */
+    for (uint32_t i = 0; i <= 255; i++) {
+        changes += debounce(raw_, cooked_, MATRIX_ROWS, false);
+        advance_time(1);
+    }
+    EXPECT_TRUE(std::equal(std::begin(raw_), std::end(raw_), std::begin(cooked_)));
+    EXPECT_GT(changes, 0U);
+
+    printf("debounce benchmark: %s %dx%d: %.1f ns/scan", DEBOUNCE_BENCHMARK_STR(DEBOUNCE_BENCHMARK_TYPE), MATRIX_ROWS, MATRIX_COLS, elapsed / SCANS);
+#ifdef DEBOUNCE_BENCHMARK_CYCLES
+    printf(", %.1f cycles/scan", (double)cycles / SCANS);
+#endif
+    printf("\n");
+}
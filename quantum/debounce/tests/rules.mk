@@ -39,6 +39,17 @@ debounce_sym_defer_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pr.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_defer_pr_tests.cpp
 
+debounce_sym_defer_pk_bs_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_pk_bs_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_bs.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+
+debounce_sym_defer_pk_us_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_pk_us_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_us.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_us_tests.cpp
+
 debounce_sym_eager_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_eager_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_eager_pk.c \
@@ -53,3 +64,17 @@ debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+# Benchmarks, one per algorithm and matrix size: debounce_benchmark_<algorithm>_<rows>x<cols>
+DEBOUNCE_BENCHMARK_TYPES := none sym_defer_g sym_defer_pk sym_defer_pk_bs sym_defer_pk_us sym_defer_pr sym_eager_pk sym_eager_pr asym_eager_defer_pk
+DEBOUNCE_BENCHMARK_SIZES := 6x22 16x32
+
+define DEBOUNCE_BENCHMARK
+debounce_benchmark_$(1)_$(2)_DEFS := -DMATRIX_ROWS=$(firstword $(subst x, ,$(2))) -DMATRIX_COLS=$(lastword $(subst x, ,$(2))) -DDEBOUNCE=5 -DDEBOUNCE_BENCHMARK_TYPE=$(1)
+debounce_benchmark_$(1)_$(2)_SRC := $(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/$(1).c \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
+endef
+
+$(foreach TYPE,$(DEBOUNCE_BENCHMARK_TYPES),$(foreach SIZE,$(DEBOUNCE_BENCHMARK_SIZES),$(eval $(call DEBOUNCE_BENCHMARK,$(TYPE),$(SIZE)))))
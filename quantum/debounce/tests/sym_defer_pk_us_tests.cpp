@@ -0,0 +1,84 @@
+/* Copyright 2026 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "debounce.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* The behaviour is the same as sym_defer_pk (see sym_defer_pk_tests.cpp), these check the recorded edge times */
+
+class DebounceEdgeTime : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(7777);
+        debounce_init(MATRIX_ROWS);
+    }
+
+    void TearDown() override {
+        debounce_free();
+    }
+
+    matrix_row_t raw_[MATRIX_ROWS]    = {0};
+    matrix_row_t cooked_[MATRIX_ROWS] = {0};
+};
+
+TEST_F(DebounceEdgeTime, RecordsTimeOfEdge) {
+    uint32_t time_us;
+
+    raw_[1] = 1 << 2;
+    EXPECT_FALSE(debounce(raw_, cooked_, MATRIX_ROWS, true));
+
+    advance_time(DEBOUNCE);
+    EXPECT_TRUE(debounce(raw_, cooked_, MATRIX_ROWS, false));
+    EXPECT_EQ(cooked_[1], 1 << 2);
+
+    ASSERT_TRUE(debounce_get_edge_time(1, 2, &time_us));
+    EXPECT_EQ(time_us, 7777U * 1000);
+}
+
+TEST_F(DebounceEdgeTime, BounceRestartsEdge) {
+    uint32_t time_us;
+
+    raw_[0] = 1 << 3;
+    debounce(raw_, cooked_, MATRIX_ROWS, true);
+    advance_time(1);
+    raw_[0] = 0;
+    debounce(raw_, cooked_, MATRIX_ROWS, true);
+    advance_time(1);
+    raw_[0] = 1 << 3;
+    debounce(raw_, cooked_, MATRIX_ROWS, true);
+
+    advance_time(DEBOUNCE - 1);
+    EXPECT_FALSE(debounce(raw_, cooked_, MATRIX_ROWS, false));
+    advance_time(1);
+    EXPECT_TRUE(debounce(raw_, cooked_, MATRIX_ROWS, false));
+
+    ASSERT_TRUE(debounce_get_edge_time(0, 3, &time_us));
+    EXPECT_EQ(time_us, (7777U + 2) * 1000);
+}
+
+TEST_F(DebounceEdgeTime, OutOfRange) {
+    uint32_t time_us;
+
+    EXPECT_FALSE(debounce_get_edge_time(MATRIX_ROWS, 0, &time_us));
+    EXPECT_FALSE(debounce_get_edge_time(0, MATRIX_COLS, &time_us));
+}
@@ -2,7 +2,29 @@ TEST_LIST += \
 	debounce_none \
 	debounce_sym_defer_g \
 	debounce_sym_defer_pk \
+	debounce_sym_defer_pk_bs \
+	debounce_sym_defer_pk_us \
 	debounce_sym_defer_pr \
 	debounce_sym_eager_pk \
 	debounce_sym_eager_pr \
 	debounce_asym_eager_defer_pk
+
+BENCHMARK_LIST += \
+	debounce_benchmark_none_6x22 \
+	debounce_benchmark_none_16x32 \
+	debounce_benchmark_sym_defer_g_6x22 \
+	debounce_benchmark_sym_defer_g_16x32 \
+	debounce_benchmark_sym_defer_pk_6x22 \
+	debounce_benchmark_sym_defer_pk_16x32 \
+	debounce_benchmark_sym_defer_pk_bs_6x22 \
+	debounce_benchmark_sym_defer_pk_bs_16x32 \
+	debounce_benchmark_sym_defer_pk_us_6x22 \
+	debounce_benchmark_sym_defer_pk_us_16x32 \
+	debounce_benchmark_sym_defer_pr_6x22 \
+	debounce_benchmark_sym_defer_pr_16x32 \
+	debounce_benchmark_sym_eager_pk_6x22 \
+	debounce_benchmark_sym_eager_pk_16x32 \
+	debounce_benchmark_sym_eager_pr_6x22 \
+	debounce_benchmark_sym_eager_pr_16x32 \
+	debounce_benchmark_asym_eager_defer_pk_6x22 \
+	debounce_benchmark_asym_eager_defer_pk_16x32
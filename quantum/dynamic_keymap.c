@@ -17,10 +17,12 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
+#include "util.h"
 
 #ifdef VIA_ENABLE
 #    include "via.h"
@@ -101,17 +103,35 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#define DYNAMIC_KEYMAP_LAYER_SIZE (MATRIX_ROWS * MATRIX_COLS * 2)
+
+// RAM mirror of the first N keymap layers, so that keycode lookups on the
+// hot path (layer resolution, ghost detection, ...) don't hit the EEPROM.
+#ifdef DYNAMIC_KEYMAP_CACHE_ENABLE
+#    ifndef DYNAMIC_KEYMAP_CACHE_LAYER_COUNT
+#        define DYNAMIC_KEYMAP_CACHE_LAYER_COUNT DYNAMIC_KEYMAP_LAYER_COUNT
+#    endif
+#    ifndef DYNAMIC_KEYMAP_CACHE_MAX_SIZE
+#        define DYNAMIC_KEYMAP_CACHE_MAX_SIZE (DYNAMIC_KEYMAP_CACHE_LAYER_COUNT * DYNAMIC_KEYMAP_LAYER_SIZE)
+#    endif
+#    define DYNAMIC_KEYMAP_CACHED_LAYERS (MIN(MIN(DYNAMIC_KEYMAP_CACHE_LAYER_COUNT, DYNAMIC_KEYMAP_LAYER_COUNT), (DYNAMIC_KEYMAP_CACHE_MAX_SIZE) / DYNAMIC_KEYMAP_LAYER_SIZE))
+
+_Static_assert(DYNAMIC_KEYMAP_CACHED_LAYERS > 0, "DYNAMIC_KEYMAP_CACHE_MAX_SIZE is too small to hold a single keymap layer.");
+
+static uint16_t dynamic_keymap_cache[DYNAMIC_KEYMAP_CACHED_LAYERS][MATRIX_ROWS][MATRIX_COLS];
+static bool     dynamic_keymap_cache_valid = false;
+#endif // DYNAMIC_KEYMAP_CACHE_ENABLE
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
 void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column) {
     // TODO: optimize this with some left shifts
-    return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+    return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * DYNAMIC_KEYMAP_LAYER_SIZE) + (row * MATRIX_COLS * 2) + (column * 2);
 }
 
-uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
-    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+static uint16_t dynamic_keymap_read_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
@@ -119,12 +139,49 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
     return keycode;
 }
 
+void dynamic_keymap_init(void) {
+#ifdef DYNAMIC_KEYMAP_CACHE_ENABLE
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_CACHED_LAYERS; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                dynamic_keymap_cache[layer][row][column] = dynamic_keymap_read_keycode(layer, row, column);
+            }
+        }
+    }
+    dynamic_keymap_cache_valid = true;
+#endif // DYNAMIC_KEYMAP_CACHE_ENABLE
+}
+
+uint8_t dynamic_keymap_get_cached_layer_count(void) {
+#ifdef DYNAMIC_KEYMAP_CACHE_ENABLE
+    return DYNAMIC_KEYMAP_CACHED_LAYERS;
+#else
+    return 0;
+#endif // DYNAMIC_KEYMAP_CACHE_ENABLE
+}
+
+uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_CACHE_ENABLE
+    if (dynamic_keymap_cache_valid && layer < DYNAMIC_KEYMAP_CACHED_LAYERS) {
+        return dynamic_keymap_cache[layer][row][column];
+    }
+#endif // DYNAMIC_KEYMAP_CACHE_ENABLE
+    return dynamic_keymap_read_keycode(layer, row, column);
+}
+
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#ifdef DYNAMIC_KEYMAP_CACHE_ENABLE
+    if (layer < DYNAMIC_KEYMAP_CACHED_LAYERS) {
+        dynamic_keymap_cache[layer][row][column] = keycode;
+    }
+#endif // DYNAMIC_KEYMAP_CACHE_ENABLE
+    effective_layer_cache_invalidate();
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -168,8 +225,8 @@ void dynamic_keymap_reset(void) {
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * DYNAMIC_KEYMAP_LAYER_SIZE;
+    void *   source                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
@@ -183,16 +240,29 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * DYNAMIC_KEYMAP_LAYER_SIZE;
+    void *   target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
             eeprom_update_byte(target, *source);
+#ifdef DYNAMIC_KEYMAP_CACHE_ENABLE
+            // Cache is laid out exactly like the EEPROM, just in native endianness
+            uint16_t index = (offset + i) / 2;
+            if (index < DYNAMIC_KEYMAP_CACHED_LAYERS * MATRIX_ROWS * MATRIX_COLS) {
+                uint16_t *keycode = &((uint16_t *)dynamic_keymap_cache)[index];
+                if ((offset + i) & 1) {
+                    *keycode = (*keycode & 0xFF00) | *source;
+                } else {
+                    *keycode = (*keycode & 0x00FF) | ((uint16_t)*source << 8);
+                }
+            }
+#endif // DYNAMIC_KEYMAP_CACHE_ENABLE
         }
         source++;
         target++;
     }
+    effective_layer_cache_invalidate();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,7 +290,7 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -234,7 +304,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -18,7 +18,10 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// Loads the RAM keymap cache (if DYNAMIC_KEYMAP_CACHE_ENABLE) from EEPROM
+void     dynamic_keymap_init(void);
 uint8_t  dynamic_keymap_get_layer_count(void);
+uint8_t  dynamic_keymap_get_cached_layer_count(void);
 void *   dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column);
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
 void     dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode);
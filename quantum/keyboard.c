@@ -32,6 +32,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "action_util.h"
+#include "perf_stats.h"
+#include "tracepoint.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -59,6 +62,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef RGB_MATRIX_ENABLE
 #    include "rgb_matrix.h"
 #endif
+#ifdef LED_COMPOSITOR_ENABLE
+#    include "led_compositor.h"
+#endif
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #endif
@@ -104,6 +110,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
@@ -345,6 +354,14 @@ __attribute__((weak)) bool matrix_can_read(void) {
     return true;
 }
 
+/** \brief matrix_get_edge_time
+ *
+ * Allows custom matrix implementations to provide the time of the last change of a switch.
+ */
+__attribute__((weak)) bool matrix_get_edge_time(uint8_t row, uint8_t col, uint32_t *time_us) {
+    return false;
+}
+
 /** \brief keyboard_setup
  *
  * FIXME: needs doc
@@ -413,9 +430,13 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+    TRACE_BEGIN(housekeeping_task);
+    perf_stats_task_begin(PERF_STATS_HOUSEKEEPING_TASK);
     housekeeping_task_modules();
     housekeeping_task_kb();
     housekeeping_task_user();
+    perf_stats_task_end(PERF_STATS_HOUSEKEEPING_TASK);
+    TRACE_END(housekeeping_task);
 }
 
 /** \brief quantum_init
@@ -462,6 +483,9 @@ void keyboard_init(void) {
 #endif
     matrix_init();
     quantum_init();
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_init();
+#endif
     led_init_ports();
 #ifdef BACKLIGHT_ENABLE
     backlight_init_ports();
@@ -563,6 +587,29 @@ static inline void generate_tick_event(void) {
     }
 }
 
+/** \brief Get the time of a key event
+ *
+ * Uses the time of the edge recorded by the debounce algorithm when available, instead of the time of the scan
+ * which reported the change. Event times never go backwards, even if keys reported by the same scan changed in a
+ * different order.
+ */
+static uint16_t key_event_time(uint8_t row, uint8_t col, uint16_t scan_time) {
+    static uint16_t last_time = 0;
+    uint32_t        edge_us;
+
+    if (!matrix_get_edge_time(row, col, &edge_us)) {
+        last_time = scan_time;
+        return scan_time;
+    }
+
+    uint32_t age = timer_elapsed_us(edge_us) / 1000;
+    if (age > TIMER_DIFF_16(scan_time, last_time)) {
+        age = TIMER_DIFF_16(scan_time, last_time);
+    }
+    last_time = scan_time - age;
+    return last_time;
+}
+
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
@@ -592,12 +639,17 @@ static bool matrix_task(void) {
         return matrix_changed;
     }
 
+    perf_stats_matrix_changed();
+
     if (debug_config.matrix) {
         matrix_print();
     }
 
     const bool process_keypress = should_process_keypress();
 
+    // Send a single keyboard report for all keys which changed in this scan
+    begin_keyboard_report_batch();
+
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         const matrix_row_t current_row = matrix_get_row(row);
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
@@ -612,7 +664,9 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+                    event.time       = key_event_time(row, col, event.time);
+                    action_exec(event);
                 }
 
                 switch_events(row, col, key_pressed);
@@ -622,6 +676,8 @@ static bool matrix_task(void) {
         matrix_previous[row] = current_row;
     }
 
+    end_keyboard_report_batch();
+
     return matrix_changed;
 }
 
@@ -707,26 +763,45 @@ void quantum_task(void) {
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+
+    TRACE_BEGIN(keyboard_task);
+    perf_stats_task_begin(PERF_STATS_KEYBOARD_TASK);
+    TRACE_BEGIN(matrix_task);
+    perf_stats_task_begin(PERF_STATS_MATRIX_TASK);
+    const bool matrix_changed = matrix_task();
+    perf_stats_task_end(PERF_STATS_MATRIX_TASK);
+    TRACE_END(matrix_task);
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
+    perf_stats_task_begin(PERF_STATS_QUANTUM_TASK);
     quantum_task();
+    perf_stats_task_end(PERF_STATS_QUANTUM_TASK);
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
+    perf_stats_task_begin(PERF_STATS_RGBLIGHT_TASK);
     rgblight_task();
+    perf_stats_task_end(PERF_STATS_RGBLIGHT_TASK);
 #endif
 
 #ifdef LED_MATRIX_ENABLE
+    perf_stats_task_begin(PERF_STATS_LED_MATRIX_TASK);
     led_matrix_task();
+    perf_stats_task_end(PERF_STATS_LED_MATRIX_TASK);
 #endif
 #ifdef RGB_MATRIX_ENABLE
+    perf_stats_task_begin(PERF_STATS_RGB_MATRIX_TASK);
     rgb_matrix_task();
+    perf_stats_task_end(PERF_STATS_RGB_MATRIX_TASK);
+#endif
+#ifdef LED_COMPOSITOR_ENABLE
+    led_compositor_task();
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -736,14 +811,20 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    perf_stats_task_begin(PERF_STATS_ENCODER_TASK);
+    const bool encoder_changed = encoder_task();
+    perf_stats_task_end(PERF_STATS_ENCODER_TASK);
+    if (encoder_changed) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    perf_stats_task_begin(PERF_STATS_POINTING_DEVICE_TASK);
+    const bool pointing_device_changed = pointing_device_task();
+    perf_stats_task_end(PERF_STATS_POINTING_DEVICE_TASK);
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
@@ -795,4 +876,8 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+    perf_stats_task_end(PERF_STATS_KEYBOARD_TASK);
+    perf_stats_task();
+    TRACE_END(keyboard_task);
 }
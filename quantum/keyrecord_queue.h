@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "action.h"
+#include "util.h"
+
+/* Fixed capacity FIFO of key records, shared by the tapping engine and combos.
+ *
+ * Records are addressed by a handle, their position from the oldest record, so
+ * that they can be inspected and modified in place while they are queued.
+ * Handles are only valid until records are dropped from the front. Side data
+ * can be kept in a parallel array, indexed by keyrecord_queue_slot().
+ *
+ * The tapping engine and combos each have a queue of their own. A record
+ * replayed from the combo buffer into the tapping engine is still copied into
+ * the waiting buffer, as action_tapping_process() takes its record by value.
+ */
+typedef struct {
+    keyrecord_t *records;
+    uint8_t      size;
+    uint8_t      first; // slot of the oldest record
+    uint8_t      count;
+} keyrecord_queue_t;
+
+#define KEYRECORD_QUEUE(storage) \
+    { .records = (storage), .size = ARRAY_SIZE(storage), .first = 0, .count = 0 }
+
+static inline uint8_t keyrecord_queue_count(const keyrecord_queue_t *queue) {
+    return queue->count;
+}
+
+static inline bool keyrecord_queue_is_empty(const keyrecord_queue_t *queue) {
+    return queue->count == 0;
+}
+
+static inline bool keyrecord_queue_is_full(const keyrecord_queue_t *queue) {
+    return queue->count == queue->size;
+}
+
+/* Storage index of the record with the given handle. */
+static inline uint8_t keyrecord_queue_slot(const keyrecord_queue_t *queue, uint8_t handle) {
+    uint8_t slot = queue->first + handle;
+    return slot >= queue->size ? slot - queue->size : slot;
+}
+
+static inline keyrecord_t *keyrecord_queue_get(const keyrecord_queue_t *queue, uint8_t handle) {
+    return &queue->records[keyrecord_queue_slot(queue, handle)];
+}
+
+/* Append a record, to be filled in place. Returns NULL when the queue is full. */
+static inline keyrecord_t *keyrecord_queue_push(keyrecord_queue_t *queue) {
+    if (keyrecord_queue_is_full(queue)) {
+        return NULL;
+    }
+    return keyrecord_queue_get(queue, queue->count++);
+}
+
+/* Drop the given number of records from the front. Their storage is reused by
+ * the next push, so copy a record out first if it is still needed after
+ * dropping it and anything it calls might push. */
+static inline void keyrecord_queue_drop(keyrecord_queue_t *queue, uint8_t count) {
+    queue->first = keyrecord_queue_slot(queue, count);
+    queue->count -= count;
+}
+
+static inline void keyrecord_queue_clear(keyrecord_queue_t *queue) {
+    queue->first = 0;
+    queue->count = 0;
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "led_compositor.h"
+#include "ws2812.h"
+#include "color.h"
+#include "util.h"
+#include <string.h>
+
+#ifdef RGB_MATRIX_ENABLE
+// The RGB Matrix layer may be written by its render thread
+#    include "synchronization_util.h"
+#    define led_compositor_lock() rgb_matrix_lock()
+#    define led_compositor_unlock() rgb_matrix_unlock()
+#else
+#    define led_compositor_lock()
+#    define led_compositor_unlock()
+#endif
+
+static rgb_t       layer_buffer[LED_LAYER_COUNT][WS2812_LED_COUNT];
+static led_blend_t layer_blend[LED_LAYER_COUNT];
+static bool        frame_dirty;
+static bool        initialized;
+
+void led_compositor_init(void) {
+    // RGBLIGHT and RGB Matrix both initialise their driver
+    if (initialized) {
+        return;
+    }
+    initialized = true;
+
+    memset(layer_buffer, 0, sizeof(layer_buffer));
+    memset(layer_blend, 0, sizeof(layer_blend));
+    ws2812_init();
+    frame_dirty = true;
+}
+
+void led_compositor_set_color(led_layer_t layer, int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (layer >= LED_LAYER_COUNT || index < 0 || index >= WS2812_LED_COUNT) {
+        return;
+    }
+
+    rgb_t *led = &layer_buffer[layer][index];
+    led->r     = red;
+    led->g     = green;
+    led->b     = blue;
+}
+
+void led_compositor_set_color_all(led_layer_t layer, uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        led_compositor_set_color(layer, i, red, green, blue);
+    }
+}
+
+void led_compositor_flush(led_layer_t layer) {
+    (void)layer;
+    frame_dirty = true;
+}
+
+void led_compositor_set_blend(led_layer_t layer, led_blend_t blend) {
+    if (layer >= LED_LAYER_COUNT || layer_blend[layer] == blend) {
+        return;
+    }
+    layer_blend[layer] = blend;
+    frame_dirty        = true;
+}
+
+led_blend_t led_compositor_get_blend(led_layer_t layer) {
+    return layer < LED_LAYER_COUNT ? layer_blend[layer] : LED_BLEND_OFF;
+}
+
+static inline uint8_t blend_channel(led_blend_t blend, uint8_t below, uint8_t above) {
+    switch (blend) {
+        case LED_BLEND_ADD:
+            return MIN((uint16_t)below + above, 255);
+        case LED_BLEND_LIGHTEN:
+            return MAX(below, above);
+        default:
+            return above;
+    }
+}
+
+void led_compositor_task(void) {
+    led_compositor_lock();
+    if (!frame_dirty) {
+        led_compositor_unlock();
+        return;
+    }
+    frame_dirty = false;
+
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        rgb_t out = {0, 0, 0};
+
+        for (uint8_t layer = 0; layer < LED_LAYER_COUNT; layer++) {
+            led_blend_t blend = layer_blend[layer];
+            rgb_t       led   = layer_buffer[layer][i];
+
+            if (blend == LED_BLEND_OFF || (blend == LED_BLEND_NORMAL && !(led.r | led.g | led.b))) {
+                continue;
+            }
+            out.r = blend_channel(blend, out.r, led.r);
+            out.g = blend_channel(blend, out.g, led.g);
+            out.b = blend_channel(blend, out.b, led.b);
+        }
+
+        ws2812_set_color(i, out.r, out.g, out.b);
+    }
+    led_compositor_unlock();
+
+    ws2812_flush();
+}
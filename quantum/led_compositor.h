@@ -0,0 +1,66 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * \file
+ *
+ * \defgroup led_compositor LED Compositor
+ *
+ * \brief Composites RGBLIGHT, RGB Matrix and indicator layers into a single
+ * frame, for keyboards where they share one WS2812 chain. Each layer has its
+ * own buffer, indexed by position in the chain, and the chain is flushed once
+ * per frame.
+ *
+ * \{
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** \brief Layers, from bottom to top
+ */
+typedef enum {
+    LED_LAYER_RGBLIGHT,
+    LED_LAYER_RGB_MATRIX,
+    LED_LAYER_INDICATORS,
+    LED_LAYER_COUNT,
+} led_layer_t;
+
+/** \brief How a layer is combined with the layers below it
+ */
+typedef enum {
+    LED_BLEND_NORMAL,  // Lit LEDs replace the ones below, black is transparent
+    LED_BLEND_ADD,     // Channels are added, saturating at 255
+    LED_BLEND_LIGHTEN, // The brightest value of each channel is kept
+    LED_BLEND_OFF,     // The layer is not shown
+} led_blend_t;
+
+/** \brief Initialise the compositor and the WS2812 driver. Safe to call more than once.
+ */
+void led_compositor_init(void);
+
+/** \brief Set the colour of a single LED in a layer.
+ */
+void led_compositor_set_color(led_layer_t layer, int index, uint8_t red, uint8_t green, uint8_t blue);
+
+/** \brief Set the colour of every LED in a layer.
+ */
+void led_compositor_set_color_all(led_layer_t layer, uint8_t red, uint8_t green, uint8_t blue);
+
+/** \brief Mark the frame of a layer as complete, to be sent with the next composited frame.
+ */
+void led_compositor_flush(led_layer_t layer);
+
+/** \brief Change how a layer is combined with the layers below it.
+ */
+void led_compositor_set_blend(led_layer_t layer, led_blend_t blend);
+
+led_blend_t led_compositor_get_blend(led_layer_t layer);
+
+/** \brief Composite and send a frame, if any layer was flushed since the last one.
+ */
+void led_compositor_task(void);
+
+/** \} */
@@ -72,6 +72,12 @@ int main(void) {
         deferred_exec_task();
 #endif // DEFERRED_EXEC_ENABLE
 
+#ifdef TRACEPOINT_ENABLE
+        // Drain recorded trace events
+        void tracepoint_task(void);
+        tracepoint_task();
+#endif // TRACEPOINT_ENABLE
+
         housekeeping_task();
     }
 }
@@ -22,6 +22,24 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "debounce.h"
 #include "atomic_util.h"
 
+#ifdef MATRIX_INTERRUPT_WAKEUP
+#    if !defined(PROTOCOL_CHIBIOS)
+#        error "MATRIX_INTERRUPT_WAKEUP is only supported on ChibiOS"
+#    endif
+#    include <hal.h>
+#    include "timer.h"
+#    include "keyboard.h"
+#    if !defined(PAL_USE_CALLBACKS) || (PAL_USE_CALLBACKS != TRUE)
+#        error "MATRIX_INTERRUPT_WAKEUP requires PAL_USE_CALLBACKS to be enabled in halconf.h"
+#    endif
+#    ifndef MATRIX_INTERRUPT_WAKEUP_IDLE_TIME
+#        define MATRIX_INTERRUPT_WAKEUP_IDLE_TIME 100
+#    endif
+#    ifndef MATRIX_INTERRUPT_WAKEUP_MAX_SLEEP
+#        define MATRIX_INTERRUPT_WAKEUP_MAX_SLEEP 1
+#    endif
+#endif
+
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
@@ -270,6 +288,151 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_INTERRUPT_WAKEUP
+// Once the matrix has been idle for a while, all outputs are driven active and the
+// inputs are armed for pin change interrupts. Until an edge is seen nothing can be
+// pressed, so scanning is skipped and the main thread may sleep.
+static bool               matrix_wakeup_armed   = false;
+static volatile bool      matrix_wakeup_pending = false;
+static thread_reference_t matrix_wakeup_thread  = NULL;
+static uint32_t           matrix_last_activity  = 0;
+
+static void matrix_wakeup_cb(void *arg) {
+    (void)arg;
+    chSysLockFromISR();
+    matrix_wakeup_pending = true;
+    chThdResumeI(&matrix_wakeup_thread, MSG_OK);
+    chSysUnlockFromISR();
+}
+
+static void matrix_wakeup_enable_input(pin_t pin) {
+    if (pin != NO_PIN) {
+        palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+        palSetLineCallback(pin, matrix_wakeup_cb, NULL);
+        // Catch anything pressed in between the last scan and arming
+        if (readMatrixPin(pin) == 0) {
+            matrix_wakeup_pending = true;
+        }
+    }
+}
+
+static void matrix_wakeup_disable_input(pin_t pin) {
+    if (pin != NO_PIN) {
+        palDisableLineEvent(pin);
+    }
+}
+
+static void matrix_wakeup_arm(void) {
+    matrix_wakeup_pending = false;
+#    ifdef DIRECT_PINS
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            matrix_wakeup_enable_input(direct_pins[row][col]);
+        }
+    }
+#    elif (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (row_pins[row] != NO_PIN) {
+            gpio_atomic_set_pin_output_low(row_pins[row]);
+        }
+    }
+    matrix_output_select_delay();
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        matrix_wakeup_enable_input(col_pins[col]);
+    }
+#    elif (DIODE_DIRECTION == ROW2COL)
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] != NO_PIN) {
+            gpio_atomic_set_pin_output_low(col_pins[col]);
+        }
+    }
+    matrix_output_select_delay();
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        matrix_wakeup_enable_input(row_pins[row]);
+    }
+#    endif
+    matrix_wakeup_armed = true;
+}
+
+static void matrix_wakeup_disarm(void) {
+#    ifdef DIRECT_PINS
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            matrix_wakeup_disable_input(direct_pins[row][col]);
+        }
+    }
+#    elif (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        matrix_wakeup_disable_input(col_pins[col]);
+    }
+    unselect_rows();
+    matrix_output_unselect_delay(0, true);
+#    elif (DIODE_DIRECTION == ROW2COL)
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        matrix_wakeup_disable_input(row_pins[row]);
+    }
+    unselect_cols();
+    matrix_output_unselect_delay(0, true);
+#    endif
+    matrix_wakeup_armed = false;
+}
+
+static bool matrix_wakeup_can_sleep(void) {
+#    ifdef SPLIT_KEYBOARD
+    // The master also has to poll the other half, which has no way to wake it
+    if (is_keyboard_master()) {
+        return false;
+    }
+#    endif
+    return true;
+}
+
+/** \brief Returns true if the matrix pins have to be read this scan
+ */
+static bool matrix_wakeup_task(void) {
+    if (!matrix_wakeup_armed) {
+        return true;
+    }
+
+    if (matrix_wakeup_can_sleep()) {
+        chSysLock();
+        if (!matrix_wakeup_pending) {
+            chThdSuspendTimeoutS(&matrix_wakeup_thread, TIME_MS2I(MATRIX_INTERRUPT_WAKEUP_MAX_SLEEP));
+        }
+        chSysUnlock();
+    }
+
+    if (!matrix_wakeup_pending) {
+        return false;
+    }
+
+    matrix_wakeup_disarm();
+    matrix_last_activity = timer_read32();
+    return true;
+}
+
+static void matrix_wakeup_update(bool changed) {
+    if (matrix_wakeup_armed) {
+        return;
+    }
+
+    bool active = changed;
+    for (uint8_t row = 0; row < ROWS_PER_HAND && !active; row++) {
+#    ifdef SPLIT_KEYBOARD
+        active = raw_matrix[row] || matrix[thisHand + row];
+#    else
+        active = raw_matrix[row] || matrix[row];
+#    endif
+    }
+
+    if (active) {
+        matrix_last_activity = timer_read32();
+    } else if (timer_elapsed32(matrix_last_activity) >= MATRIX_INTERRUPT_WAKEUP_IDLE_TIME) {
+        matrix_wakeup_arm();
+    }
+}
+#endif // MATRIX_INTERRUPT_WAKEUP
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -309,6 +472,10 @@ void matrix_init(void) {
 
     debounce_init(ROWS_PER_HAND);
 
+#ifdef MATRIX_INTERRUPT_WAKEUP
+    matrix_last_activity = timer_read32();
+#endif
+
     matrix_init_kb();
 }
 
@@ -320,9 +487,7 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
-uint8_t matrix_scan(void) {
-    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
-
+static void matrix_read(matrix_row_t curr_matrix[]) {
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
@@ -335,6 +500,19 @@ uint8_t matrix_scan(void) {
         matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
     }
 #endif
+}
+
+uint8_t matrix_scan(void) {
+    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
+
+#ifdef MATRIX_INTERRUPT_WAKEUP
+    // While armed and no edge has been seen, the matrix is known to be empty
+    if (matrix_wakeup_task()) {
+        matrix_read(curr_matrix);
+    }
+#else
+    matrix_read(curr_matrix);
+#endif
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
@@ -345,5 +523,9 @@ uint8_t matrix_scan(void) {
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
     matrix_scan_kb();
 #endif
+
+#ifdef MATRIX_INTERRUPT_WAKEUP
+    matrix_wakeup_update(changed);
+#endif
     return (uint8_t)changed;
 }
@@ -57,6 +57,8 @@ bool matrix_can_read(void);
 bool matrix_is_on(uint8_t row, uint8_t col);
 /* matrix state on row */
 matrix_row_t matrix_get_row(uint8_t row);
+/* time in microseconds (timer_read_us) of the last debounced change of a switch, if known */
+bool matrix_get_edge_time(uint8_t row, uint8_t col, uint32_t *time_us);
 /* print matrix for debug */
 void matrix_print(void);
 /* delay between changing matrix pin state and reading values */
@@ -178,6 +178,21 @@ __attribute__((weak)) uint8_t matrix_scan(void) {
     return changed;
 }
 
+__attribute__((weak)) bool debounce_get_edge_time(uint8_t row, uint8_t col, uint32_t *time_us) {
+    return false;
+}
+
+bool matrix_get_edge_time(uint8_t row, uint8_t col, uint32_t *time_us) {
+#ifdef SPLIT_KEYBOARD
+    // Only changes of this half go through the local debounce algorithm
+    if (row < thisHand || row >= thisHand + ROWS_PER_HAND) {
+        return false;
+    }
+    row -= thisHand;
+#endif
+    return debounce_get_edge_time(row, col, time_us);
+}
+
 __attribute__((weak)) bool peek_matrix(uint8_t row_index, uint8_t col_index, bool raw) {
     return 0 != ((raw ? raw_matrix[row_index] : matrix[row_index]) & (MATRIX_ROW_SHIFTER << col_index));
 }
@@ -0,0 +1,121 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "perf_stats.h"
+#include "timer.h"
+#include "util.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    include "chibios_config.h"
+#endif
+
+#if defined(PROTOCOL_CHIBIOS) && (PORT_SUPPORTS_RT == TRUE)
+#    define PERF_STATS_TIMESTAMP() chSysGetRealtimeCounterX()
+#    define PERF_STATS_TICKS_TO_US(ticks) ((ticks) / ((REALTIME_COUNTER_CLOCK) / 1000000UL))
+#else
+// Millisecond resolution fallback
+#    define PERF_STATS_TIMESTAMP() timer_read32()
+#    define PERF_STATS_TICKS_TO_US(ticks) ((ticks) * 1000)
+#endif
+
+static perf_stats_t perf_stats[PERF_STATS_COUNT];
+static uint32_t     perf_stats_start[PERF_STATS_COUNT];
+
+static bool     scan_to_report_pending = false;
+static uint32_t scan_rate_timer        = 0;
+static uint32_t scan_count             = 0;
+static uint32_t last_scan_count        = 0;
+
+static uint8_t perf_stats_bucket(uint32_t duration_us) {
+    uint8_t bucket = 0;
+    while (duration_us && bucket < PERF_STATS_HISTOGRAM_BUCKETS - 1) {
+        duration_us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void perf_stats_record(perf_stats_id_t id, uint32_t duration_us) {
+    if (id >= PERF_STATS_COUNT) {
+        return;
+    }
+
+    perf_stats_t *stats = &perf_stats[id];
+    if (stats->count < UINT32_MAX) {
+        stats->count++;
+    }
+    stats->last_us = duration_us;
+    stats->max_us  = MAX(stats->max_us, duration_us);
+
+    uint16_t *bucket = &stats->histogram[perf_stats_bucket(duration_us)];
+    if (*bucket < UINT16_MAX) {
+        (*bucket)++;
+    }
+}
+
+void perf_stats_task_begin(perf_stats_id_t id) {
+    if (id < PERF_STATS_COUNT) {
+        perf_stats_start[id] = PERF_STATS_TIMESTAMP();
+    }
+}
+
+void perf_stats_task_end(perf_stats_id_t id) {
+    if (id < PERF_STATS_COUNT) {
+        perf_stats_record(id, PERF_STATS_TICKS_TO_US(PERF_STATS_TIMESTAMP() - perf_stats_start[id]));
+    }
+}
+
+void perf_stats_matrix_changed(void) {
+    // Measure from the most recent change, so keys that never produce a
+    // report (layer keys etc.) don't inflate the next measurement
+    perf_stats_task_begin(PERF_STATS_SCAN_TO_REPORT);
+    scan_to_report_pending = true;
+}
+
+void perf_stats_report_sent(void) {
+    if (scan_to_report_pending) {
+        perf_stats_task_end(PERF_STATS_SCAN_TO_REPORT);
+        scan_to_report_pending = false;
+    }
+}
+
+void perf_stats_task(void) {
+    scan_count++;
+
+    uint32_t timer_now = timer_read32();
+    if (TIMER_DIFF_32(timer_now, scan_rate_timer) >= 1000) {
+        last_scan_count = scan_count;
+        scan_rate_timer = timer_now;
+        scan_count      = 0;
+    }
+}
+
+uint32_t perf_stats_get_scan_rate(void) {
+    return last_scan_count;
+}
+
+const perf_stats_t *perf_stats_get(perf_stats_id_t id) {
+    if (id >= PERF_STATS_COUNT) {
+        return NULL;
+    }
+    return &perf_stats[id];
+}
+
+void perf_stats_reset(void) {
+    memset(perf_stats, 0, sizeof(perf_stats));
+    scan_to_report_pending = false;
+    scan_count             = 0;
+    last_scan_count        = 0;
+    scan_rate_timer        = timer_read32();
+}
+
+uint8_t perf_stats_read_raw(perf_stats_id_t id, uint8_t offset, uint8_t *data, uint8_t length) {
+    if (id >= PERF_STATS_COUNT || offset >= sizeof(perf_stats_t)) {
+        return 0;
+    }
+    uint8_t size = MIN(length, sizeof(perf_stats_t) - offset);
+    memcpy(data, (const uint8_t *)&perf_stats[id] + offset, size);
+    return size;
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * \file
+ *
+ * \defgroup perf_stats Performance statistics
+ *
+ * \brief Records per-task execution time and scan-to-report latency
+ * histograms, so regressions in main loop timing can be measured on device
+ * (over raw HID) and in unit tests.
+ *
+ * \{
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef PERF_STATS_HISTOGRAM_BUCKETS
+#    define PERF_STATS_HISTOGRAM_BUCKETS 16
+#endif
+
+/** \brief Tracked tasks/latencies
+ */
+typedef enum {
+    PERF_STATS_KEYBOARD_TASK,
+    PERF_STATS_MATRIX_TASK,
+    PERF_STATS_QUANTUM_TASK,
+    PERF_STATS_RGBLIGHT_TASK,
+    PERF_STATS_LED_MATRIX_TASK,
+    PERF_STATS_RGB_MATRIX_TASK,
+    PERF_STATS_ENCODER_TASK,
+    PERF_STATS_POINTING_DEVICE_TASK,
+    PERF_STATS_HOUSEKEEPING_TASK,
+    PERF_STATS_SCAN_TO_REPORT,
+    PERF_STATS_COUNT,
+} perf_stats_id_t;
+
+/** \brief Statistics for a single task
+ *
+ * Histogram bucket 0 counts samples below 1us, bucket n counts samples in
+ * the range [2^(n-1), 2^n) us, and the last bucket also counts everything
+ * above it. Counters saturate instead of wrapping.
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint16_t histogram[PERF_STATS_HISTOGRAM_BUCKETS];
+} perf_stats_t;
+
+#ifdef PERF_STATS_ENABLE
+
+/** \brief Marks the start of a task
+ */
+void perf_stats_task_begin(perf_stats_id_t id);
+
+/** \brief Marks the end of a task, recording the time since perf_stats_task_begin()
+ */
+void perf_stats_task_end(perf_stats_id_t id);
+
+/** \brief Records a raw duration sample for the given id
+ */
+void perf_stats_record(perf_stats_id_t id, uint32_t duration_us);
+
+/** \brief Notes a matrix change, (re)starting the scan-to-report latency measurement
+ */
+void perf_stats_matrix_changed(void);
+
+/** \brief Notes that a keyboard report has been handed to the host driver
+ */
+void perf_stats_report_sent(void);
+
+/** \brief Updates the scan rate, call once per main loop iteration
+ */
+void perf_stats_task(void);
+
+/** \brief Main loop iterations during the previous second
+ */
+uint32_t perf_stats_get_scan_rate(void);
+
+/** \brief Read-only access to the statistics of a task
+ */
+const perf_stats_t *perf_stats_get(perf_stats_id_t id);
+
+/** \brief Clears all recorded statistics
+ */
+void perf_stats_reset(void);
+
+/** \brief Copies up to length bytes of the statistics of a task, starting at offset
+ *
+ * Used to transfer statistics over raw HID. Multi-byte values are in the
+ * native (little-endian) byte order of the device.
+ *
+ * \return The number of bytes copied
+ */
+uint8_t perf_stats_read_raw(perf_stats_id_t id, uint8_t offset, uint8_t *data, uint8_t length);
+
+#else
+
+#    define perf_stats_task_begin(id)
+#    define perf_stats_task_end(id)
+#    define perf_stats_matrix_changed()
+#    define perf_stats_report_sent()
+#    define perf_stats_task()
+
+#endif // PERF_STATS_ENABLE
+
+/** \} */
@@ -26,6 +26,18 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#include "keyrecord_queue.h"
+
+#ifdef COMBO_KEYCODE_INDEX
+#    include <stdlib.h>
+#    include <string.h>
+
+#    ifdef PROTOCOL_CHIBIOS
+#        if CH_CFG_USE_MEMCORE == FALSE
+#            error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with COMBO_KEYCODE_INDEX.
+#        endif
+#    endif
+#endif
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -85,13 +97,12 @@ static uint16_t timer = 0;
 static bool     b_combo_enable = true; // defaults to enabled
 static uint16_t longest_term   = 0;
 
-typedef struct {
-    keyrecord_t record;
-    uint16_t    combo_index;
-    uint16_t    keycode;
-} queued_record_t;
-static uint8_t         key_buffer_size = 0;
-static queued_record_t key_buffer[COMBO_KEY_BUFFER_LENGTH];
+/* Buffered key records, with their keycode and the combo they trigger (if
+ * any) kept alongside, indexed by the slot of the record. */
+static keyrecord_t       key_buffer_records[COMBO_KEY_BUFFER_LENGTH];
+static uint16_t          key_buffer_keycodes[COMBO_KEY_BUFFER_LENGTH];
+static uint16_t          key_buffer_combo_index[COMBO_KEY_BUFFER_LENGTH];
+static keyrecord_queue_t key_buffer = KEYRECORD_QUEUE(key_buffer_records);
 
 typedef struct {
     uint16_t combo_index;
@@ -102,6 +113,24 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_KEYCODE_INDEX
+/* Inverted index from keycode to the combos containing it, sorted by keycode
+ * and then combo index. Built on first use, so that each key event only has
+ * to visit the combos it can affect, instead of every combo. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+    uint8_t  key_index;
+} combo_keycode_index_entry_t;
+
+static combo_keycode_index_entry_t *keycode_index        = NULL;
+static uint8_t                     *keycode_index_counts = NULL; // number of keys of each combo
+static uint8_t                     *touched_combos       = NULL; // one bit per combo which may have state to clear
+static uint16_t                     keycode_index_size   = 0;
+static uint16_t                     indexed_combo_count  = 0;
+static bool                         keycode_index_built  = false;
+#endif
+
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
 #    define COMBO_ACTIVE(combo) (combo->active)
@@ -202,6 +231,26 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_KEYCODE_INDEX
+    if (touched_combos != NULL) {
+        // Only combos which were visited since the last time can have any state
+        for (uint16_t byte = 0; byte < (indexed_combo_count + 7) / 8; ++byte) {
+            uint8_t touched = touched_combos[byte];
+            for (uint8_t bit = 0; touched; ++bit, touched >>= 1) {
+                index = byte * 8 + bit;
+                if (!(touched & 1) || index >= indexed_combo_count) {
+                    continue;
+                }
+                combo_t *combo = combo_get(index);
+                if (!COMBO_ACTIVE(combo)) {
+                    RESET_COMBO_STATE(combo);
+                    touched_combos[byte] &= ~(1 << bit);
+                }
+            }
+        }
+        return;
+    }
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -211,36 +260,32 @@ void clear_combos(void) {
 }
 
 static inline void dump_key_buffer(void) {
-    /* First call start from 0 index; recursive calls need to start from i+1 index */
-    static uint8_t key_buffer_next = 0;
 #if TAP_CODE_DELAY > 0
     bool delay_done = false;
 #endif
 
-    if (key_buffer_size == 0) {
-        return;
-    }
-
-    for (uint8_t key_buffer_i = key_buffer_next; key_buffer_i < key_buffer_size; key_buffer_i++) {
-        key_buffer_next = key_buffer_i + 1;
+    while (!keyrecord_queue_is_empty(&key_buffer)) {
+        /* Records are dropped before they are processed, so that recursive
+         * calls continue with the next one. A recursive call may push into
+         * the freed slot, so only a copy of the record is used from here. */
+        uint8_t     slot        = keyrecord_queue_slot(&key_buffer, 0);
+        keyrecord_t record      = key_buffer_records[slot];
+        uint16_t    combo_index = key_buffer_combo_index[slot];
+        keyrecord_queue_drop(&key_buffer, 1);
 
-        queued_record_t *qrecord = &key_buffer[key_buffer_i];
-        keyrecord_t *    record  = &qrecord->record;
-
-        if (IS_NOEVENT(record->event)) {
+        if (IS_NOEVENT(record.event)) {
             continue;
         }
 
-        if (!record->keycode && qrecord->combo_index != (uint16_t)-1) {
-            process_combo_event(qrecord->combo_index, true);
+        if (!record.keycode && combo_index != (uint16_t)-1) {
+            process_combo_event(combo_index, true);
         } else {
 #ifndef NO_ACTION_TAPPING
-            action_tapping_process(*record);
+            action_tapping_process(record);
 #else
-            process_record(record);
+            process_record(&record);
 #endif
         }
-        record->event.type = TICK_EVENT;
 
 #if defined(CAPS_WORD_ENABLE) && defined(AUTO_SHIFT_ENABLE)
         // Edge case: preserve the weak Left Shift mod if both Caps Word and
@@ -254,17 +299,14 @@ static inline void dump_key_buffer(void) {
 
 #if TAP_CODE_DELAY > 0
         // only delay once and for a non-tapping key
-        if (!delay_done && !is_tap_record(record)) {
+        if (!delay_done && !is_tap_record(&record)) {
             delay_done = true;
             wait_ms(TAP_CODE_DELAY);
         }
 #endif
     }
-
-    key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -286,6 +328,110 @@ static inline void _find_key_index_and_count(const uint16_t *keys, uint16_t keyc
     }
 }
 
+#ifdef COMBO_KEYCODE_INDEX
+static int keycode_index_compare(const void *a, const void *b) {
+    const combo_keycode_index_entry_t *entry_a = a;
+    const combo_keycode_index_entry_t *entry_b = b;
+
+    if (entry_a->keycode != entry_b->keycode) {
+        return entry_a->keycode < entry_b->keycode ? -1 : 1;
+    }
+    if (entry_a->combo_index != entry_b->combo_index) {
+        return entry_a->combo_index < entry_b->combo_index ? -1 : 1;
+    }
+    return (int)entry_a->key_index - (int)entry_b->key_index;
+}
+
+static void free_keycode_index(void) {
+    free(keycode_index);
+    free(keycode_index_counts);
+    free(touched_combos);
+    keycode_index        = NULL;
+    keycode_index_counts = NULL;
+    touched_combos       = NULL;
+    keycode_index_size   = 0;
+    indexed_combo_count  = 0;
+}
+
+static void build_keycode_index(void) {
+    free_keycode_index();
+    keycode_index_built = true;
+
+    uint16_t count       = combo_count();
+    uint16_t total_keys  = 0;
+    keycode_index_counts = (uint8_t *)malloc(count);
+    touched_combos       = (uint8_t *)malloc((count + 7) / 8);
+    if (keycode_index_counts == NULL || touched_combos == NULL) {
+        // Fall back to checking every combo
+        free_keycode_index();
+        return;
+    }
+    // The state of the combos is unknown, so clear all of them next time
+    memset(touched_combos, 0xFF, (count + 7) / 8);
+    indexed_combo_count = count;
+
+    for (uint16_t combo_index = 0; combo_index < count; ++combo_index) {
+        uint8_t  key_count = 0;
+        uint16_t key_index = -1;
+        _find_key_index_and_count(combo_get(combo_index)->keys, COMBO_END, &key_index, &key_count);
+        keycode_index_counts[combo_index] = key_count;
+        total_keys += key_count;
+    }
+
+    keycode_index = (combo_keycode_index_entry_t *)malloc(total_keys * sizeof(combo_keycode_index_entry_t));
+    if (keycode_index == NULL) {
+        free_keycode_index();
+        return;
+    }
+
+    for (uint16_t combo_index = 0; combo_index < count; ++combo_index) {
+        const uint16_t *keys = combo_get(combo_index)->keys;
+        for (uint8_t key_index = 0; key_index < keycode_index_counts[combo_index]; ++key_index) {
+            keycode_index[keycode_index_size++] = (combo_keycode_index_entry_t){
+                .keycode     = pgm_read_word(&keys[key_index]),
+                .combo_index = combo_index,
+                .key_index   = key_index,
+            };
+        }
+    }
+    qsort(keycode_index, keycode_index_size, sizeof(combo_keycode_index_entry_t), keycode_index_compare);
+
+    /* A keycode which is in a combo more than once only counts as its last
+     * key, the same as _find_key_index_and_count(). */
+    uint16_t size = 0;
+    for (uint16_t i = 0; i < keycode_index_size; ++i) {
+        if (size > 0 && keycode_index[size - 1].keycode == keycode_index[i].keycode && keycode_index[size - 1].combo_index == keycode_index[i].combo_index) {
+            size--;
+        }
+        keycode_index[size++] = keycode_index[i];
+    }
+    keycode_index_size = size;
+}
+
+/* Returns the first entry for the keycode, or where it would be. */
+static uint16_t find_keycode_index(uint16_t keycode) {
+    uint16_t low  = 0;
+    uint16_t high = keycode_index_size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (keycode_index[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/** \brief Rebuild the keycode index before the next key event
+ *
+ * Call this whenever the keys of the combos returned by combo_get() change.
+ */
+void combo_keycode_index_invalidate(void) {
+    keycode_index_built = false;
+}
+#endif
+
 void drop_combo_from_buffer(uint16_t combo_index) {
     /* Mark a combo as processed from the buffer. If the buffer is in the
      * beginning of the buffer, drop it.  */
@@ -323,10 +469,10 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
     uint8_t state = 0;
 #endif
 
-    for (uint8_t key_buffer_i = 0; key_buffer_i < key_buffer_size; key_buffer_i++) {
-        queued_record_t *qrecord = &key_buffer[key_buffer_i];
-        keyrecord_t *    record  = &qrecord->record;
-        uint16_t         keycode = qrecord->keycode;
+    for (uint8_t key_buffer_i = 0; key_buffer_i < keyrecord_queue_count(&key_buffer); key_buffer_i++) {
+        uint8_t      slot    = keyrecord_queue_slot(&key_buffer, key_buffer_i);
+        keyrecord_t *record  = &key_buffer_records[slot];
+        uint16_t     keycode = key_buffer_keycodes[slot];
 
         uint8_t  key_count = 0;
         uint16_t key_index = -1;
@@ -344,7 +490,7 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
             record->event.type = COMBO_EVENT;
             record->event.key  = MAKE_KEYPOS(0, 0);
 
-            qrecord->combo_index = combo_index;
+            key_buffer_combo_index[slot] = combo_index;
             ACTIVATE_COMBO(combo);
 
             break;
@@ -422,16 +568,7 @@ static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t
 }
 #endif
 
-static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
-    uint8_t  key_count = 0;
-    uint16_t key_index = -1;
-    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
-
-    /* Continue processing if key isn't part of current combo. */
-    if (-1 == (int16_t)key_index) {
-        return COMBO_KEY_NOT_PRESSED;
-    }
-
+static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index, uint16_t key_index, uint8_t key_count) {
     bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
                                  && keys_pressed_in_order(combo_index, combo, key_index, keycode, record)
@@ -552,8 +689,7 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
 }
 
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +717,33 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEYCODE_INDEX
+    if (!keycode_index_built) {
+        build_keycode_index();
+    }
+
+    if (keycode_index != NULL) {
+        for (uint16_t i = find_keycode_index(keycode); i < keycode_index_size && keycode_index[i].keycode == keycode; ++i) {
+            uint16_t idx = keycode_index[i].combo_index;
+            touched_combos[idx / 8] |= 1 << (idx % 8);
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx, keycode_index[i].key_index, keycode_index_counts[idx]);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo     = combo_get(idx);
+            uint8_t  key_count = 0;
+            uint16_t key_index = -1;
+            _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
+
+            /* Continue processing if key isn't part of current combo. */
+            if (-1 == (int16_t)key_index) {
+                continue;
+            }
+
+            is_combo_key |= process_single_combo(combo, keycode, record, idx, key_index, key_count);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -603,12 +762,12 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
         if (is_combo_key == COMBO_KEY_PRESSED)
 #endif
         {
-            if (key_buffer_size < COMBO_KEY_BUFFER_LENGTH) {
-                key_buffer[key_buffer_size++] = (queued_record_t){
-                    .record      = *record,
-                    .keycode     = keycode,
-                    .combo_index = -1, // this will be set when applying combos
-                };
+            keyrecord_t *queued = keyrecord_queue_push(&key_buffer);
+            if (queued != NULL) {
+                uint8_t slot                 = queued - key_buffer_records;
+                *queued                      = *record;
+                key_buffer_keycodes[slot]    = keycode;
+                key_buffer_combo_index[slot] = -1; // this will be set when applying combos
             }
         }
     } else {
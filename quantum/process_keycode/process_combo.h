@@ -22,6 +22,10 @@
 #include "keycodes.h"
 #include "quantum_keycodes.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #ifdef EXTRA_SHORT_COMBOS
 #    define MAX_COMBO_LENGTH 6
 #elif defined(EXTRA_EXTRA_LONG_COMBOS)
@@ -81,3 +85,11 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_KEYCODE_INDEX
+void combo_keycode_index_invalidate(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
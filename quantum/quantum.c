@@ -582,6 +582,10 @@ void suspend_power_down_quantum(void) {
 #    if defined(RGB_MATRIX_ENABLE)
     rgb_matrix_set_suspend_state(true);
 #    endif
+#    if defined(LED_COMPOSITOR_ENABLE)
+    // the keyboard task does not run while suspended, send the frame now
+    led_compositor_task();
+#    endif
 
 #    ifdef OLED_ENABLE
     oled_off();
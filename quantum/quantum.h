@@ -36,6 +36,10 @@
 #    include "rgb_matrix.h"
 #endif
 
+#ifdef LED_COMPOSITOR_ENABLE
+#    include "led_compositor.h"
+#endif
+
 #include "keymap_common.h"
 #include "quantum_keycodes.h"
 #include "keycode_config.h"
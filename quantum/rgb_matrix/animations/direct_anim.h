@@ -0,0 +1,25 @@
+#ifdef ENABLE_RGB_MATRIX_DIRECT
+RGB_MATRIX_EFFECT(DIRECT)
+#    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+
+// Shows the colours set with rgb_matrix_direct_set_color(), dimmed by the brightness setting
+bool DIRECT(effect_params_t* params) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    uint8_t val = rgb_matrix_config.hsv.v;
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        rgb_matrix_lock();
+        rgb_t rgb = g_rgb_direct_colors[i];
+        rgb_matrix_unlock();
+        // scale8() would take 255 down to 254, leave colours alone at full brightness
+        if (val < UINT8_MAX) {
+            rgb = (rgb_t){scale8(rgb.r, val), scale8(rgb.g, val), scale8(rgb.b, val)};
+        }
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+#    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#endif     // ENABLE_RGB_MATRIX_DIRECT
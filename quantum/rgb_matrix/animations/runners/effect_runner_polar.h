@@ -0,0 +1,64 @@
+#pragma once
+
+typedef hsv_t (*polar_f)(hsv_t hsv, uint8_t angle, uint8_t dist, uint8_t time);
+typedef hsv_t (*angle_f)(hsv_t hsv, uint8_t angle, uint8_t time);
+
+#ifdef RGB_MATRIX_POLAR_TABLE
+// Angle and distance of every LED from the centre, the layout does not change
+static struct {
+    uint8_t angle;
+    uint8_t dist;
+} led_polar[RGB_MATRIX_LED_COUNT];
+
+static void effect_runner_polar_init(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx         = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy         = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        led_polar[i].angle = atan2_8(dy, dx);
+        led_polar[i].dist  = sqrt16(dx * dx + dy * dy);
+    }
+}
+#endif // RGB_MATRIX_POLAR_TABLE
+
+bool effect_runner_polar(effect_params_t* params, polar_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    uint8_t                time  = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    rgb_matrix_hsv_batch_t batch = {0};
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+#ifdef RGB_MATRIX_POLAR_TABLE
+        uint8_t angle = led_polar[i].angle;
+        uint8_t dist  = led_polar[i].dist;
+#else
+        int16_t dx    = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy    = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        uint8_t angle = atan2_8(dy, dx);
+        uint8_t dist  = sqrt16(dx * dx + dy * dy);
+#endif
+        rgb_matrix_hsv_batch_add(&batch, i, effect_func(rgb_matrix_config.hsv, angle, dist, time));
+    }
+    rgb_matrix_hsv_batch_flush(&batch);
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+// For the effects which only use the angle, so no distance is computed without the table
+bool effect_runner_angle(effect_params_t* params, angle_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    uint8_t                time  = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    rgb_matrix_hsv_batch_t batch = {0};
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+#ifdef RGB_MATRIX_POLAR_TABLE
+        uint8_t angle = led_polar[i].angle;
+#else
+        int16_t dx    = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy    = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        uint8_t angle = atan2_8(dy, dx);
+#endif
+        rgb_matrix_hsv_batch_add(&batch, i, effect_func(rgb_matrix_config.hsv, angle, time));
+    }
+    rgb_matrix_hsv_batch_flush(&batch);
+    return rgb_matrix_check_finished_leds(led_max);
+}
@@ -16,79 +16,224 @@ RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 #        ifndef RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT
 #            define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
 #        endif
+
+// Heat decays lazily: each key remembers when its value was last brought up to
+// date, and the decay since then is applied whenever it is read. A delay of 0
+// decays by one every frame, so the clock then counts frames instead.
+#        if RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS > 0
+#            define HEATMAP_DECAY_STEP RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS
+
+static inline uint16_t heatmap_now(void) {
+    return timer_read();
+}
+#        else
+#            define HEATMAP_DECAY_STEP 1
+static uint16_t heatmap_frame;
+
+static inline uint16_t heatmap_now(void) {
+    return heatmap_frame;
+}
+#        endif
+
+// Keys which are not rendered on this side are read again at least this often,
+// so that their stamps never fall a whole 16 bit clock behind
+#        define HEATMAP_REFRESH_INTERVAL 0x4000
+
+static uint16_t heatmap_stamp[MATRIX_ROWS][MATRIX_COLS];
+static uint16_t heatmap_refreshed;
+
+static uint8_t heatmap_read(uint8_t row, uint8_t col, uint16_t now) {
+    uint8_t val = g_rgb_frame_buffer[row][col];
+    if (!val) {
+        return 0;
+    }
+
+    uint16_t steps = TIMER_DIFF_16(now, heatmap_stamp[row][col]) / HEATMAP_DECAY_STEP;
+    if (steps) {
+        val                          = steps >= val ? 0 : val - steps;
+        g_rgb_frame_buffer[row][col] = val;
+        // keep the part of a step which has already passed
+        heatmap_stamp[row][col] += steps * HEATMAP_DECAY_STEP;
+    }
+    return val;
+}
+
+static void heatmap_refresh(uint16_t now) {
+    if (TIMER_DIFF_16(now, heatmap_refreshed) < HEATMAP_REFRESH_INTERVAL) {
+        return;
+    }
+    heatmap_refreshed = now;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            heatmap_read(row, col, now);
+        }
+    }
+}
+
+static void heatmap_add(uint8_t row, uint8_t col, uint8_t amount, uint16_t now) {
+    uint8_t val = heatmap_read(row, col, now);
+    if (!val) {
+        heatmap_stamp[row][col] = now;
+    }
+    g_rgb_frame_buffer[row][col] = qadd8(val, amount);
+}
+
+#        ifndef RGB_MATRIX_TYPING_HEATMAP_SLIM
+#            ifndef RGB_MATRIX_TYPING_HEATMAP_NEIGHBOUR_LIMIT
+#                ifdef __AVR__
+#                    define RGB_MATRIX_TYPING_HEATMAP_NEIGHBOUR_LIMIT 0
+#                else
+#                    define RGB_MATRIX_TYPING_HEATMAP_NEIGHBOUR_LIMIT (RGB_MATRIX_LED_COUNT * 6)
+#                endif
+#            endif
+
+// Amount of heat spread from the key at point a to the key at point b, 0 if out of range
+static uint8_t heatmap_spread(led_point_t a, led_point_t b) {
+    int16_t dx = a.x - b.x;
+    int16_t dy = a.y - b.y;
+    if (abs(dx) > RGB_MATRIX_TYPING_HEATMAP_SPREAD || abs(dy) > RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+        return 0;
+    }
+
+    uint8_t distance = sqrt16(dx * dx + dy * dy);
+    if (distance > RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+        return 0;
+    }
+    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
+    return amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT ? RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT : amount;
+}
+
+#            if RGB_MATRIX_TYPING_HEATMAP_NEIGHBOUR_LIMIT > 0
+typedef struct {
+    uint8_t row;
+    uint8_t col;
+    uint8_t amount;
+} heatmap_neighbour_t;
+
+// Neighbours of every LED, in order of LED index. LEDs from heatmap_neighbour_leds
+// onwards did not fit, and look for their neighbours on every press instead.
+static heatmap_neighbour_t heatmap_neighbours[RGB_MATRIX_TYPING_HEATMAP_NEIGHBOUR_LIMIT];
+static uint16_t            heatmap_neighbour_start[RGB_MATRIX_LED_COUNT + 1];
+static uint8_t             heatmap_neighbour_leds;
+
+static void heatmap_build_neighbours(void) {
+    uint16_t count = 0;
+
+    heatmap_neighbour_leds = 0;
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+        heatmap_neighbour_start[led] = count;
+
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                uint8_t target = g_led_config.matrix_co[row][col];
+                if (target == NO_LED || target == led) {
+                    continue;
+                }
+
+                uint8_t amount = heatmap_spread(g_led_config.point[led], g_led_config.point[target]);
+                if (!amount) {
+                    continue;
+                }
+                if (count == RGB_MATRIX_TYPING_HEATMAP_NEIGHBOUR_LIMIT) {
+                    return;
+                }
+                heatmap_neighbours[count++] = (heatmap_neighbour_t){row, col, amount};
+            }
+        }
+
+        heatmap_neighbour_start[led + 1] = count;
+        heatmap_neighbour_leds           = led + 1;
+    }
+}
+#            endif
+#        endif
+
+// Called with rgb_matrix_lock held
 void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
+    uint16_t now = heatmap_now();
+
 #        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
     // Limit effect to pressed keys
-    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+    heatmap_add(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP, now);
 #        else
-    if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
+    uint8_t led = g_led_config.matrix_co[row][col];
+    if (led == NO_LED) { // skip as pressed key doesn't have an led position
+        return;
+    }
+    heatmap_add(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP, now);
+
+#            if RGB_MATRIX_TYPING_HEATMAP_NEIGHBOUR_LIMIT > 0
+    if (led < heatmap_neighbour_leds) {
+        for (uint16_t i = heatmap_neighbour_start[led]; i < heatmap_neighbour_start[led + 1]; i++) {
+            heatmap_neighbour_t *neighbour = &heatmap_neighbours[i];
+            heatmap_add(neighbour->row, neighbour->col, neighbour->amount, now);
+        }
         return;
     }
+#            endif
+
     for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
         for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
-            if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
+            uint8_t target = g_led_config.matrix_co[i_row][i_col];
+            if (target == NO_LED || target == led) { // skip as target key doesn't have an led position
                 continue;
             }
-            if (i_row == row && i_col == col) {
-                g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
-            } else {
-#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
-                uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
-#            undef LED_DISTANCE
-                if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
-                    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
-                    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
-                        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
-                    }
-                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
-                }
+            uint8_t amount = heatmap_spread(g_led_config.point[led], g_led_config.point[target]);
+            if (amount) {
+                heatmap_add(i_row, i_col, amount, now);
             }
         }
     }
 #        endif
 }
 
-// A timer to track the last time we decremented all heatmap values.
-static uint16_t heatmap_decrease_timer;
-// Whether we should decrement the heatmap values during the next update.
-static bool decrease_heatmap_values;
-
 bool TYPING_HEATMAP(effect_params_t* params) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
-        memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
     }
 
-    // The heatmap animation might run in several iterations depending on
-    // `RGB_MATRIX_LED_PROCESS_LIMIT`, therefore we only want to update the
-    // timer when the animation starts.
+    // key presses update the heatmap from the keyboard task
+    rgb_matrix_lock();
+    if (params->init) {
+        memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
+#        if !defined(RGB_MATRIX_TYPING_HEATMAP_SLIM) && RGB_MATRIX_TYPING_HEATMAP_NEIGHBOUR_LIMIT > 0
+        heatmap_build_neighbours();
+#        endif
+    }
+#        if RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS == 0
     if (params->iter == 0) {
-        decrease_heatmap_values = timer_elapsed(heatmap_decrease_timer) >= RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS;
-
-        // Restart the timer if we are going to decrease the heatmap this frame.
-        if (decrease_heatmap_values) {
-            heatmap_decrease_timer = timer_read();
-        }
+        heatmap_frame++;
+    }
+#        endif
+    uint16_t now = heatmap_now();
+    if (params->init) {
+        heatmap_refreshed = now;
     }
+    heatmap_refresh(now);
+    rgb_matrix_unlock();
 
-    // Render heatmap & decrease
+    // Render heatmap, keys which have cooled down are simply turned off
     uint8_t count = 0;
     for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
         for (uint8_t col = 0; col < MATRIX_COLS && RGB_MATRIX_LED_PROCESS_LIMIT; col++) {
-            if (g_led_config.matrix_co[row][col] >= led_min && g_led_config.matrix_co[row][col] < led_max) {
+            uint8_t led = g_led_config.matrix_co[row][col];
+            if (led >= led_min && led < led_max) {
                 count++;
-                uint8_t val = g_rgb_frame_buffer[row][col];
-                if (!HAS_ANY_FLAGS(g_led_config.flags[g_led_config.matrix_co[row][col]], params->flags)) continue;
+                rgb_matrix_lock();
+                uint8_t val = heatmap_read(row, col, now);
+                rgb_matrix_unlock();
+                if (!HAS_ANY_FLAGS(g_led_config.flags[led], params->flags)) continue;
+
+                if (!val) {
+                    rgb_matrix_set_color(led, 0, 0, 0);
+                    continue;
+                }
 
                 hsv_t hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
                 rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
-                rgb_matrix_set_color(g_led_config.matrix_co[row][col], rgb.r, rgb.g, rgb.b);
-
-                if (decrease_heatmap_values) {
-                    g_rgb_frame_buffer[row][col] = qsub8(val, 1);
-                }
+                rgb_matrix_set_color(led, rgb.r, rgb.g, rgb.b);
             }
         }
     }
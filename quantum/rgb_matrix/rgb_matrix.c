@@ -22,22 +22,60 @@
 #include "eeconfig.h"
 #include "keyboard.h"
 #include "sync_timer.h"
+#include "timer.h"
+#include "util.h"
 #include "debug.h"
+#include "synchronization_util.h"
 #include <string.h>
 #include <math.h>
 #include <stdlib.h>
 
 #include <lib/lib8tion/lib8tion.h>
 
+#ifdef RGB_MATRIX_THREADED
+#    ifndef PROTOCOL_CHIBIOS
+#        error RGB_MATRIX_THREADED is only supported on ChibiOS
+#    endif
+#    include <ch.h>
+#    ifndef RGB_MATRIX_THREAD_PRIORITY
+#        define RGB_MATRIX_THREAD_PRIORITY NORMALPRIO
+#    endif
+#    ifndef RGB_MATRIX_THREAD_STACK_SIZE
+#        define RGB_MATRIX_THREAD_STACK_SIZE 512
+#    endif
+#endif // RGB_MATRIX_THREADED
+
 #ifndef RGB_MATRIX_CENTER
 const led_point_t k_rgb_matrix_center = {112, 32};
 #else
 const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 #endif
 
+#ifdef __ELF__
+static rgb_t rgb_matrix_hsv_to_rgb_default(hsv_t hsv) {
+    return hsv_to_rgb(hsv);
+}
+
+// Weak alias, so that rgb_matrix_hsv_to_rgb_many() can tell when it has been overridden
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) __attribute__((weak, alias("rgb_matrix_hsv_to_rgb_default")));
+#else
 __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
+#endif
+
+// Used by the effect runners. Only converts the whole batch at once while rgb_matrix_hsv_to_rgb() is the default.
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_many(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+#ifdef __ELF__
+    if (rgb_matrix_hsv_to_rgb == rgb_matrix_hsv_to_rgb_default) {
+        hsv_to_rgb_many(hsv, rgb, count);
+        return;
+    }
+#endif
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+}
 
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
@@ -66,6 +104,9 @@ uint32_t     g_rgb_timer;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
+#ifdef ENABLE_RGB_MATRIX_DIRECT
+rgb_t g_rgb_direct_colors[RGB_MATRIX_LED_COUNT];
+#endif // ENABLE_RGB_MATRIX_DIRECT
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -76,6 +117,8 @@ static uint8_t         rgb_last_enable   = UINT8_MAX;
 static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state    = SYNCING;
+// set under the lock by the keyboard task, the renderer restarts the frame at its next step
+static bool rgb_task_restart = false;
 
 // double buffers
 static uint32_t rgb_timer_buffer;
@@ -88,6 +131,22 @@ static last_hit_t last_hit_buffer;
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
 
+#ifdef RGB_MATRIX_SHADOW_FRAMEBUFFER
+// colours set by effects, and which of them have changed since the last flush
+static rgb_t                    rgb_shadow_buffer[RGB_MATRIX_LED_COUNT];
+static uint8_t                  rgb_shadow_dirty[(RGB_MATRIX_LED_COUNT + 7) / 8];
+static rgb_matrix_frame_stats_t rgb_frame_stats;
+#endif // RGB_MATRIX_SHADOW_FRAMEBUFFER
+
+#ifdef RGB_MATRIX_TARGET_FPS
+// frame pacing, all times in microseconds unless noted
+static uint32_t                  rgb_frame_deadline;
+static uint32_t                  rgb_stats_window; // milliseconds
+static uint16_t                  rgb_stats_frames;
+static uint32_t                  rgb_stats_worst_slice;
+static rgb_matrix_render_stats_t rgb_render_stats;
+#endif // RGB_MATRIX_TARGET_FPS
+
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, EECONFIG_RGB_MATRIX, rgb_matrix_config);
 
 void eeconfig_update_rgb_matrix(void) {
@@ -96,11 +155,13 @@ void eeconfig_update_rgb_matrix(void) {
 
 void eeconfig_update_rgb_matrix_default(void) {
     dprintf("eeconfig_update_rgb_matrix_default\n");
+    rgb_matrix_lock();
     rgb_matrix_config.enable = RGB_MATRIX_DEFAULT_ON;
     rgb_matrix_config.mode   = RGB_MATRIX_DEFAULT_MODE;
     rgb_matrix_config.hsv    = (hsv_t){RGB_MATRIX_DEFAULT_HUE, RGB_MATRIX_DEFAULT_SAT, RGB_MATRIX_DEFAULT_VAL};
     rgb_matrix_config.speed  = RGB_MATRIX_DEFAULT_SPD;
     rgb_matrix_config.flags  = RGB_MATRIX_DEFAULT_FLAGS;
+    rgb_matrix_unlock();
     eeconfig_flush_rgb_matrix(true);
 }
 
@@ -140,9 +201,59 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
 }
 
 void rgb_matrix_update_pwm_buffers(void) {
+#ifdef RGB_MATRIX_SHADOW_FRAMEBUFFER
+    uint32_t start   = timer_read_us();
+    uint16_t changed = 0;
+
+#    ifdef RGB_MATRIX_THREADED
+    // hand the frame over in one go, colours set by the keyboard task meanwhile go into the next one
+    static rgb_t front_buffer[RGB_MATRIX_LED_COUNT];
+    uint8_t      dirty_leds[ARRAY_SIZE(rgb_shadow_dirty)];
+    rgb_matrix_lock();
+    memcpy(front_buffer, rgb_shadow_buffer, sizeof(front_buffer));
+    memcpy(dirty_leds, rgb_shadow_dirty, sizeof(dirty_leds));
+    memset(rgb_shadow_dirty, 0, sizeof(rgb_shadow_dirty));
+    rgb_matrix_unlock();
+#    else
+    rgb_t   *front_buffer = rgb_shadow_buffer;
+    uint8_t *dirty_leds   = rgb_shadow_dirty;
+#    endif // RGB_MATRIX_THREADED
+
+    // only pass the LEDs which changed down to the driver
+    for (uint8_t i = 0; i < ARRAY_SIZE(rgb_shadow_dirty); i++) {
+        uint8_t dirty = dirty_leds[i];
+        if (!dirty) {
+            continue;
+        }
+        dirty_leds[i] = 0;
+
+        for (uint8_t index = i * 8; dirty; index++, dirty >>= 1) {
+            if (dirty & 1) {
+                rgb_t *led = &front_buffer[index];
+                rgb_matrix_driver.set_color(rgb_matrix_led_index(index), led->r, led->g, led->b);
+                changed++;
+            }
+        }
+    }
+
+    // nothing to do for the driver if the frame is unchanged
+    if (changed) {
+        rgb_matrix_driver.flush();
+    }
+
+    rgb_frame_stats.leds_changed  = changed;
+    rgb_frame_stats.flush_time_us = timer_elapsed_us(start);
+#else
     rgb_matrix_driver.flush();
+#endif // RGB_MATRIX_SHADOW_FRAMEBUFFER
 }
 
+#ifdef RGB_MATRIX_SHADOW_FRAMEBUFFER
+rgb_matrix_frame_stats_t rgb_matrix_get_frame_stats(void) {
+    return rgb_frame_stats;
+}
+#endif // RGB_MATRIX_SHADOW_FRAMEBUFFER
+
 __attribute__((weak)) int rgb_matrix_led_index(int index) {
 #if defined(RGB_MATRIX_SPLIT)
     if (!is_keyboard_left() && index >= k_rgb_matrix_split[0]) {
@@ -153,11 +264,28 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_SHADOW_FRAMEBUFFER
+    if (index < 0 || index >= RGB_MATRIX_LED_COUNT) {
+        return;
+    }
+
+    rgb_matrix_lock_autounlock();
+    rgb_t *led = &rgb_shadow_buffer[index];
+    if (led->r == red && led->g == green && led->b == blue) {
+        return;
+    }
+
+    led->r = red;
+    led->g = green;
+    led->b = blue;
+    rgb_shadow_dirty[index / 8] |= 1 << (index % 8);
+#else
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
+#endif // RGB_MATRIX_SHADOW_FRAMEBUFFER
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_SPLIT) || defined(RGB_MATRIX_SHADOW_FRAMEBUFFER)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
@@ -165,11 +293,32 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 #endif
 }
 
+#ifdef ENABLE_RGB_MATRIX_DIRECT
+void rgb_matrix_direct_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (index < 0 || index >= RGB_MATRIX_LED_COUNT) {
+        return;
+    }
+
+    rgb_matrix_lock_autounlock();
+    g_rgb_direct_colors[index] = (rgb_t){red, green, blue};
+}
+
+void rgb_matrix_direct_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    rgb_matrix_lock_autounlock();
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        g_rgb_direct_colors[i] = (rgb_t){red, green, blue};
+    }
+}
+#endif // ENABLE_RGB_MATRIX_DIRECT
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
 #endif
 
+    // the render thread reads the hit tracker and the heatmap
+    rgb_matrix_lock_autounlock();
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     uint8_t led[LED_HITS_TO_REMEMBER];
     uint8_t led_count = 0;
@@ -256,6 +405,7 @@ static void rgb_task_timers(void) {
 
     // Update double buffer last hit timers
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+    rgb_matrix_lock_autounlock();
     uint8_t count = last_hit_buffer.count;
     for (uint8_t i = 0; i < count; ++i) {
         if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
@@ -267,10 +417,55 @@ static void rgb_task_timers(void) {
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 }
 
+#ifdef RGB_MATRIX_TARGET_FPS
+static bool rgb_frame_due(void) {
+    uint32_t now = timer_read_us();
+    if (!timer_expired32(now, rgb_frame_deadline)) {
+        return false;
+    }
+
+    // keep a fixed rate, unless whole frame slots were missed
+    uint32_t late = now - rgb_frame_deadline;
+    if (late >= RGB_MATRIX_FRAME_PERIOD_US) {
+        rgb_render_stats.dropped_frames += late / RGB_MATRIX_FRAME_PERIOD_US;
+        rgb_frame_deadline = now + RGB_MATRIX_FRAME_PERIOD_US;
+    } else {
+        rgb_frame_deadline += RGB_MATRIX_FRAME_PERIOD_US;
+    }
+    return true;
+}
+
+static void rgb_task_stats(uint32_t slice_time) {
+    if (slice_time > rgb_stats_worst_slice) {
+        rgb_stats_worst_slice = slice_time;
+    }
+
+    uint32_t elapsed = timer_elapsed32(rgb_stats_window);
+    if (elapsed >= 1000) {
+        rgb_render_stats.fps            = (uint32_t)rgb_stats_frames * 1000 / elapsed;
+        rgb_render_stats.worst_slice_us = rgb_stats_worst_slice;
+        rgb_stats_window += elapsed;
+        rgb_stats_frames      = 0;
+        rgb_stats_worst_slice = 0;
+    }
+}
+
+rgb_matrix_render_stats_t rgb_matrix_get_render_stats(void) {
+    return rgb_render_stats;
+}
+#endif // RGB_MATRIX_TARGET_FPS
+
 static void rgb_task_sync(void) {
+#ifndef RGB_MATRIX_THREADED
+    // with the render thread, EEPROM is written by the keyboard task instead
     eeconfig_flush_rgb_matrix(false);
+#endif // RGB_MATRIX_THREADED
     // next task
+#ifdef RGB_MATRIX_TARGET_FPS
+    if (rgb_frame_due()) rgb_task_state = STARTING;
+#else
     if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
+#endif // RGB_MATRIX_TARGET_FPS
 }
 
 static void rgb_task_start(void) {
@@ -280,7 +475,9 @@ static void rgb_task_start(void) {
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+    rgb_matrix_lock();
     g_last_hit_tracker = last_hit_buffer;
+    rgb_matrix_unlock();
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     // next task
@@ -354,23 +551,22 @@ static void rgb_task_flush(uint8_t effect) {
 
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
+#ifdef RGB_MATRIX_TARGET_FPS
+    rgb_stats_frames++;
+#endif // RGB_MATRIX_TARGET_FPS
 
     // next task
     rgb_task_state = SYNCING;
 }
 
-void rgb_matrix_task(void) {
-    rgb_task_timers();
-
-    // Ideally we would also stop sending zeros to the LED driver PWM buffers
-    // while suspended and just do a software shutdown. This is a cheap hack for now.
-    bool suspend_backlight = suspend_state ||
-#if RGB_MATRIX_TIMEOUT > 0
-                             (last_input_activity_elapsed() > (uint32_t)RGB_MATRIX_TIMEOUT) ||
-#endif // RGB_MATRIX_TIMEOUT > 0
-                             false;
-
-    uint8_t effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
+static void rgb_task_step(uint8_t effect) {
+    // only the renderer moves the state machine on, so it just needs the lock to pick up restarts
+    rgb_matrix_lock();
+    if (rgb_task_restart) {
+        rgb_task_restart = false;
+        rgb_task_state   = STARTING;
+    }
+    rgb_matrix_unlock();
 
     switch (rgb_task_state) {
         case STARTING:
@@ -394,6 +590,67 @@ void rgb_matrix_task(void) {
     }
 }
 
+static void rgb_task_run(void) {
+    rgb_task_timers();
+
+    // Ideally we would also stop sending zeros to the LED driver PWM buffers
+    // while suspended and just do a software shutdown. This is a cheap hack for now.
+    rgb_matrix_lock();
+    bool suspend_backlight = suspend_state ||
+#if RGB_MATRIX_TIMEOUT > 0
+                             (last_input_activity_elapsed() > (uint32_t)RGB_MATRIX_TIMEOUT) ||
+#endif // RGB_MATRIX_TIMEOUT > 0
+                             false;
+    uint8_t effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
+    rgb_matrix_unlock();
+
+#ifdef RGB_MATRIX_TARGET_FPS
+    // keep stepping through the frame until it is done, or the budget for this call is spent
+    uint32_t slice_start = timer_read_us();
+    uint32_t slice_time;
+    do {
+        rgb_task_step(effect);
+        slice_time = timer_elapsed_us(slice_start);
+    } while (rgb_task_state != SYNCING && slice_time < RGB_MATRIX_RENDER_BUDGET_US);
+
+    rgb_task_stats(slice_time);
+#else
+    rgb_task_step(effect);
+#endif // RGB_MATRIX_TARGET_FPS
+}
+
+#ifdef RGB_MATRIX_THREADED
+static THD_WORKING_AREA(waRgbMatrixThread, RGB_MATRIX_THREAD_STACK_SIZE);
+
+/**
+ * @brief Renders and flushes frames. Blocking driver transfers put this thread
+ * to sleep, letting the keyboard task run. ChibiOS does not time slice threads
+ * of equal priority, so give the keyboard task a turn after every slice.
+ */
+static THD_FUNCTION(RgbMatrixThread, arg) {
+    (void)arg;
+    chRegSetThreadName("rgb_matrix");
+
+    while (true) {
+        rgb_task_run();
+        if (rgb_task_state == SYNCING) {
+            chThdSleepMilliseconds(1);
+        } else {
+            chThdYield();
+        }
+    }
+}
+
+void rgb_matrix_task(void) {
+    eeconfig_flush_rgb_matrix(false);
+    chThdYield();
+}
+#else
+void rgb_matrix_task(void) {
+    rgb_task_run();
+}
+#endif // RGB_MATRIX_THREADED
+
 void rgb_matrix_indicators(void) {
     rgb_matrix_indicators_kb();
 }
@@ -455,6 +712,22 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_POLAR_TABLE
+    effect_runner_polar_init();
+#endif // RGB_MATRIX_POLAR_TABLE
+
+#ifdef RGB_MATRIX_TARGET_FPS
+    rgb_frame_deadline = timer_read_us();
+    rgb_stats_window   = timer_read32();
+#endif // RGB_MATRIX_TARGET_FPS
+
+#ifdef RGB_MATRIX_SHADOW_FRAMEBUFFER
+    // make sure the whole first frame reaches the driver
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_shadow_dirty[i / 8] |= 1 << (i % 8);
+    }
+#endif // RGB_MATRIX_SHADOW_FRAMEBUFFER
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
@@ -473,15 +746,29 @@ void rgb_matrix_init(void) {
         eeconfig_update_rgb_matrix_default();
     }
     eeconfig_debug_rgb_matrix(); // display current eeprom values
+
+#ifdef RGB_MATRIX_THREADED
+    // rgb_matrix_init() may be called again, the thread keeps running across those calls
+    static bool thread_started = false;
+    if (!thread_started) {
+        chThdCreateStatic(waRgbMatrixThread, sizeof(waRgbMatrixThread), RGB_MATRIX_THREAD_PRIORITY, RgbMatrixThread, NULL);
+        thread_started = true;
+    }
+#endif // RGB_MATRIX_THREADED
 }
 
 void rgb_matrix_set_suspend_state(bool state) {
 #ifdef RGB_MATRIX_SLEEP
+#    ifndef RGB_MATRIX_THREADED
+    // the render thread turns the LEDs off by itself, once it sees the suspend state
     if (state && !suspend_state) { // only run if turning off, and only once
         rgb_task_render(0);        // turn off all LEDs when suspending
         rgb_task_flush(0);         // and actually flash led state to LEDs
     }
+#    endif // RGB_MATRIX_THREADED
+    rgb_matrix_lock();
     suspend_state = state;
+    rgb_matrix_unlock();
 #endif
 }
 
@@ -490,8 +777,10 @@ bool rgb_matrix_get_suspend_state(void) {
 }
 
 void rgb_matrix_toggle_eeprom_helper(bool write_to_eeprom) {
+    rgb_matrix_lock();
     rgb_matrix_config.enable ^= 1;
-    rgb_task_state = STARTING;
+    rgb_task_restart = true;
+    rgb_matrix_unlock();
     eeconfig_flag_rgb_matrix(write_to_eeprom);
     dprintf("rgb matrix toggle [%s]: rgb_matrix_config.enable = %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.enable);
 }
@@ -508,7 +797,8 @@ void rgb_matrix_enable(void) {
 }
 
 void rgb_matrix_enable_noeeprom(void) {
-    if (!rgb_matrix_config.enable) rgb_task_state = STARTING;
+    rgb_matrix_lock_autounlock();
+    if (!rgb_matrix_config.enable) rgb_task_restart = true;
     rgb_matrix_config.enable = 1;
 }
 
@@ -518,7 +808,8 @@ void rgb_matrix_disable(void) {
 }
 
 void rgb_matrix_disable_noeeprom(void) {
-    if (rgb_matrix_config.enable) rgb_task_state = STARTING;
+    rgb_matrix_lock_autounlock();
+    if (rgb_matrix_config.enable) rgb_task_restart = true;
     rgb_matrix_config.enable = 0;
 }
 
@@ -530,6 +821,7 @@ void rgb_matrix_mode_eeprom_helper(uint8_t mode, bool write_to_eeprom) {
     if (!rgb_matrix_config.enable) {
         return;
     }
+    rgb_matrix_lock();
     if (mode < 1) {
         rgb_matrix_config.mode = 1;
     } else if (mode >= RGB_MATRIX_EFFECT_MAX) {
@@ -537,7 +829,8 @@ void rgb_matrix_mode_eeprom_helper(uint8_t mode, bool write_to_eeprom) {
     } else {
         rgb_matrix_config.mode = mode;
     }
-    rgb_task_state = STARTING;
+    rgb_task_restart = true;
+    rgb_matrix_unlock();
     eeconfig_flag_rgb_matrix(write_to_eeprom);
     dprintf("rgb matrix mode [%s]: %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.mode);
 }
@@ -578,9 +871,11 @@ void rgb_matrix_sethsv_eeprom_helper(uint16_t hue, uint8_t sat, uint8_t val, boo
     if (!rgb_matrix_config.enable) {
         return;
     }
+    rgb_matrix_lock();
     rgb_matrix_config.hsv.h = hue;
     rgb_matrix_config.hsv.s = sat;
     rgb_matrix_config.hsv.v = (val > RGB_MATRIX_MAXIMUM_BRIGHTNESS) ? RGB_MATRIX_MAXIMUM_BRIGHTNESS : val;
+    rgb_matrix_unlock();
     eeconfig_flag_rgb_matrix(write_to_eeprom);
     dprintf("rgb matrix set hsv [%s]: %u,%u,%u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.hsv.h, rgb_matrix_config.hsv.s, rgb_matrix_config.hsv.v);
 }
@@ -665,7 +960,9 @@ void rgb_matrix_decrease_val(void) {
 }
 
 void rgb_matrix_set_speed_eeprom_helper(uint8_t speed, bool write_to_eeprom) {
+    rgb_matrix_lock();
     rgb_matrix_config.speed = speed;
+    rgb_matrix_unlock();
     eeconfig_flag_rgb_matrix(write_to_eeprom);
     dprintf("rgb matrix set speed [%s]: %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.speed);
 }
@@ -701,7 +998,9 @@ void rgb_matrix_decrease_speed(void) {
 }
 
 void rgb_matrix_set_flags_eeprom_helper(led_flags_t flags, bool write_to_eeprom) {
+    rgb_matrix_lock();
     rgb_matrix_config.flags = flags;
+    rgb_matrix_unlock();
     eeconfig_flag_rgb_matrix(write_to_eeprom);
     dprintf("rgb matrix set flags [%s]: %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.flags);
 }
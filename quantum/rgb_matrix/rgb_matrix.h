@@ -90,6 +90,18 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+#ifdef RGB_MATRIX_TARGET_FPS
+#    define RGB_MATRIX_FRAME_PERIOD_US (1000000UL / (RGB_MATRIX_TARGET_FPS))
+#    ifndef RGB_MATRIX_RENDER_BUDGET_US
+#        define RGB_MATRIX_RENDER_BUDGET_US 500
+#    endif
+#endif
+
+// The render thread draws into the shadow framebuffer, which is handed over to the driver under a lock
+#if defined(RGB_MATRIX_THREADED) && !defined(RGB_MATRIX_SHADOW_FRAMEBUFFER)
+#    define RGB_MATRIX_SHADOW_FRAMEBUFFER
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -150,6 +162,12 @@ int rgb_matrix_led_index(int index);
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 
+#ifdef ENABLE_RGB_MATRIX_DIRECT
+// Colours shown by RGB_MATRIX_DIRECT, typically set by host software
+void rgb_matrix_direct_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+void rgb_matrix_direct_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
+#endif
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed);
 
 void rgb_matrix_task(void);
@@ -214,6 +232,25 @@ void        rgb_matrix_set_flags(led_flags_t flags);
 void        rgb_matrix_set_flags_noeeprom(led_flags_t flags);
 void        rgb_matrix_update_pwm_buffers(void);
 
+#ifdef RGB_MATRIX_SHADOW_FRAMEBUFFER
+typedef struct {
+    uint16_t leds_changed;  // LEDs passed to the driver by the last flush
+    uint32_t flush_time_us; // Time taken by the last flush, including the driver
+} rgb_matrix_frame_stats_t;
+
+rgb_matrix_frame_stats_t rgb_matrix_get_frame_stats(void);
+#endif
+
+#ifdef RGB_MATRIX_TARGET_FPS
+typedef struct {
+    uint16_t fps;            // Frames flushed during the last second
+    uint32_t dropped_frames; // Frame slots missed since startup
+    uint32_t worst_slice_us; // Longest single rgb_matrix_task() run during the last second
+} rgb_matrix_render_stats_t;
+
+rgb_matrix_render_stats_t rgb_matrix_get_render_stats(void);
+#endif
+
 #ifndef RGBLIGHT_ENABLE
 #    define eeconfig_update_rgblight_current eeconfig_update_rgb_matrix
 #    define rgblight_reload_from_eeprom rgb_matrix_reload_from_eeprom
@@ -280,3 +317,7 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef ENABLE_RGB_MATRIX_DIRECT
+// Written under rgb_matrix_lock(), as the render thread reads it
+extern rgb_t g_rgb_direct_colors[RGB_MATRIX_LED_COUNT];
+#endif
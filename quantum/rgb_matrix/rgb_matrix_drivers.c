@@ -140,10 +140,37 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .set_color_all = aw20216s_set_color_all,
 };
 
+#elif defined(RGB_MATRIX_WS2812) && defined(LED_COMPOSITOR_ENABLE)
+#    include "led_compositor.h"
+#    include "synchronization_util.h"
+
+// The layer may be written by the render thread, while led_compositor_task() reads it under the same lock
+static void rgb_matrix_compositor_flush(void) {
+    rgb_matrix_lock_autounlock();
+    led_compositor_flush(LED_LAYER_RGB_MATRIX);
+}
+
+static void rgb_matrix_compositor_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    rgb_matrix_lock_autounlock();
+    led_compositor_set_color(LED_LAYER_RGB_MATRIX, index, red, green, blue);
+}
+
+static void rgb_matrix_compositor_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    rgb_matrix_lock_autounlock();
+    led_compositor_set_color_all(LED_LAYER_RGB_MATRIX, red, green, blue);
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = led_compositor_init,
+    .flush         = rgb_matrix_compositor_flush,
+    .set_color     = rgb_matrix_compositor_set_color,
+    .set_color_all = rgb_matrix_compositor_set_color_all,
+};
+
 #elif defined(RGB_MATRIX_WS2812)
 #    if defined(RGBLIGHT_WS2812)
 #        pragma message "Cannot use RGBLIGHT and RGB Matrix using WS2812 at the same time."
-#        pragma message "You need to use a custom driver, or re-implement the WS2812 driver to use a different configuration."
+#        pragma message "You need to use a custom driver, or enable the LED compositor."
 #    endif
 
 const rgb_matrix_driver_t rgb_matrix_driver = {
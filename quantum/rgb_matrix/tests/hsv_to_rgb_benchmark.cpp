@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Host-side benchmark of hsv_to_rgb() called once per LED against
+ * hsv_to_rgb_many() called on batches, as the RGB Matrix runners do. Run with:
+ *
+ *     make bench:hsv_to_rgb_benchmark
+ *
+ * Host numbers only show the relative cost; on AVR the division in
+ * hsv_to_rgb() is a library call, so the difference is larger there.
+ */
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+
+extern "C" {
+#include "color.h"
+}
+
+/* LEDs per batch, the default RGB_MATRIX_HSV_BATCH_SIZE */
+#define BATCH_SIZE 16
+/* Total number of LEDs converted */
+#define CONVERSIONS (BATCH_SIZE * 1000000)
+
+class HsvToRgbBenchmark : public ::testing::Test {
+   protected:
+    /* A rainbow across the batch that moves every frame, like most effects */
+    void nextFrame(uint32_t frame) {
+        for (uint8_t i = 0; i < BATCH_SIZE; i++) {
+            hsv_[i] = {(uint8_t)(frame + i * 16), 255, 200};
+        }
+    }
+
+    uint32_t checksum() {
+        uint32_t sum = 0;
+        for (uint8_t i = 0; i < BATCH_SIZE; i++) {
+            sum += rgb_[i].r + rgb_[i].g + rgb_[i].b;
+        }
+        return sum;
+    }
+
+    hsv_t hsv_[BATCH_SIZE];
+    rgb_t rgb_[BATCH_SIZE];
+};
+
+TEST_F(HsvToRgbBenchmark, ConversionCost) {
+    uint32_t single_sum = 0;
+    auto     start      = std::chrono::steady_clock::now();
+    for (uint32_t frame = 0; frame < CONVERSIONS / BATCH_SIZE; frame++) {
+        nextFrame(frame);
+        for (uint8_t i = 0; i < BATCH_SIZE; i++) {
+            rgb_[i] = hsv_to_rgb(hsv_[i]);
+        }
+        single_sum += checksum();
+    }
+    auto single = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    uint32_t many_sum = 0;
+    start             = std::chrono::steady_clock::now();
+    for (uint32_t frame = 0; frame < CONVERSIONS / BATCH_SIZE; frame++) {
+        nextFrame(frame);
+        hsv_to_rgb_many(hsv_, rgb_, BATCH_SIZE);
+        many_sum += checksum();
+    }
+    auto many = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(single_sum, many_sum);
+
+    printf("hsv_to_rgb benchmark: single %.2f ns/LED, batched %.2f ns/LED\n", single / CONVERSIONS, many / CONVERSIONS);
+}
@@ -0,0 +1,56 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+}
+
+static void expect_same_as_single(const hsv_t *hsv, uint8_t count) {
+    rgb_t rgb[256];
+    hsv_to_rgb_many(hsv, rgb, count);
+    for (uint8_t i = 0; i < count; i++) {
+        rgb_t expected = hsv_to_rgb(hsv[i]);
+        ASSERT_EQ(rgb[i].r, expected.r) << "h=" << +hsv[i].h << " s=" << +hsv[i].s << " v=" << +hsv[i].v;
+        ASSERT_EQ(rgb[i].g, expected.g) << "h=" << +hsv[i].h << " s=" << +hsv[i].s << " v=" << +hsv[i].v;
+        ASSERT_EQ(rgb[i].b, expected.b) << "h=" << +hsv[i].h << " s=" << +hsv[i].s << " v=" << +hsv[i].v;
+    }
+}
+
+TEST(HsvToRgb, ManyMatchesSingleForEveryColour) {
+    hsv_t hsv[255];
+    for (uint16_t s = 0; s < 256; s++) {
+        for (uint16_t v = 0; v < 256; v++) {
+            for (uint16_t h = 0; h < 256; h++) {
+                // 255 per batch, so that the hue of the first element changes
+                hsv[(h + s + v) % 255] = {(uint8_t)h, (uint8_t)s, (uint8_t)v};
+                if ((h + s + v) % 255 == 254) {
+                    expect_same_as_single(hsv, 255);
+                }
+            }
+        }
+    }
+}
+
+TEST(HsvToRgb, ManyMatchesSingleWhenSaturationAndValueChange) {
+    hsv_t    hsv[128];
+    uint32_t seed = 1;
+    for (uint16_t batch = 0; batch < 1000; batch++) {
+        for (uint8_t i = 0; i < 128; i++) {
+            seed   = seed * 1103515245 + 12345;
+            hsv[i] = {(uint8_t)(seed >> 8), (uint8_t)((seed >> 16) & 0x3), (uint8_t)(seed >> 24)};
+            // mostly fully saturated, like most effects
+            hsv[i].s = hsv[i].s ? 255 : 0;
+        }
+        expect_same_as_single(hsv, 128);
+    }
+}
+
+TEST(HsvToRgb, EmptyBatch) {
+    rgb_t rgb = {1, 2, 3};
+    hsv_to_rgb_many(NULL, &rgb, 0);
+    EXPECT_EQ(rgb.r, 1);
+    EXPECT_EQ(rgb.g, 2);
+    EXPECT_EQ(rgb.b, 3);
+}
@@ -0,0 +1,16 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+hsv_to_rgb_SRC := \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/hsv_to_rgb_tests.cpp
+
+hsv_to_rgb_cie_DEFS := -DUSE_CIE1931_CURVE
+hsv_to_rgb_cie_SRC := \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/led_tables.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/hsv_to_rgb_tests.cpp
+
+hsv_to_rgb_benchmark_SRC := \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/hsv_to_rgb_benchmark.cpp
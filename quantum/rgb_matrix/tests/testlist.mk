@@ -0,0 +1,6 @@
+TEST_LIST += \
+	hsv_to_rgb \
+	hsv_to_rgb_cie
+
+BENCHMARK_LIST += \
+	hsv_to_rgb_benchmark
@@ -3,7 +3,29 @@
 
 #include "rgblight_drivers.h"
 
-#if defined(RGBLIGHT_WS2812)
+#if defined(RGBLIGHT_WS2812) && defined(LED_COMPOSITOR_ENABLE)
+#    include "led_compositor.h"
+
+static void rgblight_compositor_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    led_compositor_set_color(LED_LAYER_RGBLIGHT, index, red, green, blue);
+}
+
+static void rgblight_compositor_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    led_compositor_set_color_all(LED_LAYER_RGBLIGHT, red, green, blue);
+}
+
+static void rgblight_compositor_flush(void) {
+    led_compositor_flush(LED_LAYER_RGBLIGHT);
+}
+
+const rgblight_driver_t rgblight_driver = {
+    .init          = led_compositor_init,
+    .set_color     = rgblight_compositor_set_color,
+    .set_color_all = rgblight_compositor_set_color_all,
+    .flush         = rgblight_compositor_flush,
+};
+
+#elif defined(RGBLIGHT_WS2812)
 #    include "ws2812.h"
 
 const rgblight_driver_t rgblight_driver = {
@@ -22,6 +22,7 @@
 #include "quantum_keycodes.h"
 #include "keycode.h"
 #include "action.h"
+#include "action_util.h"
 #include "wait.h"
 
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
@@ -151,6 +152,8 @@ void send_string(const char *string) {
 }
 
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+    // The host has to see every character with the requested delays, rather than a merged report
+    end_keyboard_report_batch();
     while (1) {
         char ascii_code = getter(arg);
         if (!ascii_code) break;
@@ -214,6 +217,7 @@ void send_char(char ascii_code) {
 }
 
 void send_char_with_delay(char ascii_code, uint8_t interval) {
+    end_keyboard_report_batch();
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
     if (ascii_code == '\a') { // BEL
         PLAY_SONG(bell_song);
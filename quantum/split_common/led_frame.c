@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "led_frame.h"
+#include "util.h"
+
+static inline bool rgb_equal(const rgb_t *a, const rgb_t *b) {
+    return a->r == b->r && a->g == b->g && a->b == b->b;
+}
+
+uint8_t led_frame_encode(const rgb_t *leds, rgb_t *sent, uint8_t count, uint8_t *cursor, bool full, uint8_t *chunk, uint8_t size) {
+    uint8_t used  = 0;
+    uint8_t index = *cursor;
+    uint8_t end   = 0; // end of the last run, skips are relative to it
+
+    while (index < count) {
+        if (!full && rgb_equal(&leds[index], &sent[index])) {
+            index++;
+            continue;
+        }
+        if (size - used < LED_FRAME_CHUNK_MIN) {
+            break;
+        }
+
+        uint8_t *run    = &chunk[used];
+        uint8_t  length = 1;
+        while (index + length < count && length < LED_FRAME_RUN_MAX && rgb_equal(&leds[index + length], &leds[index])) {
+            length++;
+        }
+
+        run[0] = index - end;
+        if (length > 1) {
+            run[1] = LED_FRAME_FILL | length;
+            memcpy(&run[2], &leds[index], sizeof(rgb_t));
+            used += 2 + sizeof(rgb_t);
+        } else {
+            // Changed LEDs one by one, until an unchanged one, the start of a fill run or the end of the chunk
+            uint8_t room = MIN((size - used - 2) / sizeof(rgb_t), LED_FRAME_RUN_MAX);
+            while (length < room && index + length < count) {
+                uint8_t next = index + length;
+                if (!full && rgb_equal(&leds[next], &sent[next])) {
+                    break;
+                }
+                if (next + 1 < count && rgb_equal(&leds[next], &leds[next + 1])) {
+                    break;
+                }
+                length++;
+            }
+            run[1] = length;
+            memcpy(&run[2], &leds[index], length * sizeof(rgb_t));
+            used += 2 + length * sizeof(rgb_t);
+        }
+
+        memcpy(&sent[index], &leds[index], length * sizeof(rgb_t));
+        index += length;
+        end = index;
+    }
+
+    *cursor = index;
+    return used;
+}
+
+// Walks through the runs of a chunk, only checking them if leds is NULL
+static bool led_frame_apply(const uint8_t *chunk, uint8_t length, rgb_t *leds, uint8_t count) {
+    uint16_t used  = 0;
+    uint16_t index = 0;
+
+    while (used < length) {
+        if (length - used < 2) {
+            return false;
+        }
+        uint8_t run     = chunk[used + 1] & LED_FRAME_RUN_MAX;
+        bool    fill    = chunk[used + 1] & LED_FRAME_FILL;
+        uint8_t colours = fill ? 1 : run;
+        index += chunk[used];
+        used += 2;
+        if (run == 0 || index + run > count || length - used < colours * sizeof(rgb_t)) {
+            return false;
+        }
+
+        if (leds) {
+            for (uint8_t i = 0; i < run; i++) {
+                memcpy(&leds[index + i], &chunk[used + (fill ? 0 : i * sizeof(rgb_t))], sizeof(rgb_t));
+            }
+        }
+        used += colours * sizeof(rgb_t);
+        index += run;
+    }
+    return true;
+}
+
+bool led_frame_decode(const uint8_t *chunk, uint8_t length, rgb_t *leds, uint8_t count) {
+    if (!led_frame_apply(chunk, length, NULL, count)) {
+        return false;
+    }
+    return led_frame_apply(chunk, length, leds, count);
+}
@@ -0,0 +1,55 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * \file
+ *
+ * \brief Run-length coding of the LED colours which changed since they were
+ * last sent to the other half.
+ *
+ * A chunk is a sequence of runs, each starting with two bytes:
+ *
+ *   skip | header
+ *
+ * skip is the number of LEDs left as they are since the end of the previous
+ * run, or since the first LED for the first run of a chunk. If bit 7 of the
+ * header is set, one colour follows for (header & 0x7F) LEDs. Otherwise header
+ * colours follow, one for each LED. Colours are three bytes, red, green, blue.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "color.h"
+
+#define LED_FRAME_FILL 0x80
+#define LED_FRAME_RUN_MAX 0x7F
+
+// Smallest chunk that fits a run
+#define LED_FRAME_CHUNK_MIN (2 + sizeof(rgb_t))
+
+/** \brief Encodes LEDs which differ from what was last sent into a chunk
+ *
+ * Starts at LED *cursor and stops once the chunk is full. Neighbours of the
+ * same colour are sent as one run, whether they changed or not.
+ *
+ * \param leds Current colours
+ * \param sent Colours as last sent, updated with the LEDs encoded
+ * \param count Number of LEDs, at most 255
+ * \param cursor First LED to encode, advanced past the LEDs encoded. Equal to count once all changes are encoded.
+ * \param full Encode every LED, whether it changed or not
+ * \param chunk Output, at least LED_FRAME_CHUNK_MIN bytes
+ * \param size Size of the chunk
+ *
+ * \return Size of the encoded chunk, 0 if there was nothing to encode
+ */
+uint8_t led_frame_encode(const rgb_t *leds, rgb_t *sent, uint8_t count, uint8_t *cursor, bool full, uint8_t *chunk, uint8_t size);
+
+/** \brief Applies a chunk to the LED colours
+ *
+ * A chunk that is malformed, or runs past the last LED, changes nothing.
+ *
+ * \return Whether the chunk was applied
+ */
+bool led_frame_decode(const uint8_t *chunk, uint8_t length, rgb_t *leds, uint8_t count);
@@ -0,0 +1,116 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "led_frame.h"
+}
+
+#define LED_COUNT 40
+#define CHUNK_SIZE 32
+
+class LedFrame : public ::testing::Test {
+   protected:
+    // Sends chunks until the frame is complete, returns the number of bytes sent
+    size_t sync(bool full = false) {
+        size_t  total  = 0;
+        uint8_t cursor = 0;
+        while (cursor < LED_COUNT) {
+            uint8_t chunk[CHUNK_SIZE];
+            uint8_t length = led_frame_encode(leds_, sent_, LED_COUNT, &cursor, full, chunk, sizeof(chunk));
+            EXPECT_LE(length, sizeof(chunk));
+            if (length) {
+                EXPECT_TRUE(led_frame_decode(chunk, length, slave_, LED_COUNT));
+            }
+            total += length;
+        }
+        return total;
+    }
+
+    void expect_synced(void) {
+        EXPECT_EQ(memcmp(leds_, slave_, sizeof(leds_)), 0);
+        EXPECT_EQ(memcmp(leds_, sent_, sizeof(leds_)), 0);
+    }
+
+    rgb_t leds_[LED_COUNT]  = {};
+    rgb_t sent_[LED_COUNT]  = {};
+    rgb_t slave_[LED_COUNT] = {};
+};
+
+TEST_F(LedFrame, NothingChanged) {
+    EXPECT_EQ(sync(), 0U);
+}
+
+TEST_F(LedFrame, SingleLed) {
+    leds_[17] = {1, 2, 3};
+    EXPECT_EQ(sync(), 2U + 3U);
+    expect_synced();
+}
+
+TEST_F(LedFrame, SolidColourIsOneRun) {
+    for (auto &led : leds_) {
+        led = {0, 0, 255};
+    }
+    EXPECT_EQ(sync(), 2U + 3U);
+    expect_synced();
+}
+
+TEST_F(LedFrame, PerKeyColoursSpanChunks) {
+    for (uint8_t i = 0; i < LED_COUNT; i++) {
+        leds_[i] = {i, (uint8_t)(i * 7), (uint8_t)(255 - i)};
+    }
+    EXPECT_LE(sync(), LED_COUNT * 3U + 2 * ((LED_COUNT * 3U + CHUNK_SIZE - 1) / (CHUNK_SIZE - 2)));
+    expect_synced();
+
+    // Only what changed afterwards
+    leds_[3]  = {9, 9, 9};
+    leds_[4]  = {8, 8, 8};
+    leds_[30] = {7, 7, 7};
+    EXPECT_EQ(sync(), 2U + 6U + 2U + 3U);
+    expect_synced();
+}
+
+TEST_F(LedFrame, FullFrameSendsUnchangedLeds) {
+    for (uint8_t i = 0; i < LED_COUNT; i += 2) {
+        leds_[i] = {255, 0, 0};
+    }
+    sync();
+
+    // The slave lost its colours
+    memset(slave_, 0, sizeof(slave_));
+    EXPECT_EQ(sync(), 0U);
+    EXPECT_GT(sync(true), 0U);
+    expect_synced();
+}
+
+TEST_F(LedFrame, LongRunsAreSplit) {
+    rgb_t   leds[200], sent[200] = {}, slave[200] = {};
+    uint8_t chunk[CHUNK_SIZE];
+    uint8_t cursor = 0;
+    for (auto &led : leds) {
+        led = {0, 255, 0};
+    }
+
+    uint8_t length = led_frame_encode(leds, sent, 200, &cursor, false, chunk, sizeof(chunk));
+    EXPECT_EQ(cursor, 200);
+    EXPECT_EQ(length, 2 * (2 + 3));
+    EXPECT_EQ(chunk[1], LED_FRAME_FILL | LED_FRAME_RUN_MAX);
+    EXPECT_TRUE(led_frame_decode(chunk, length, slave, 200));
+    EXPECT_EQ(memcmp(leds, slave, sizeof(leds)), 0);
+}
+
+TEST_F(LedFrame, MalformedChunksChangeNothing) {
+    // Past the last LED, in the second run
+    const uint8_t past_end[] = {0, LED_FRAME_FILL | 2, 1, 1, 1, LED_COUNT - 3, LED_FRAME_FILL | 2, 1, 1, 1};
+    // Colours cut short
+    const uint8_t truncated[] = {0, 2, 1, 1, 1, 2, 2};
+    // Empty run
+    const uint8_t empty[] = {0, 0};
+
+    EXPECT_FALSE(led_frame_decode(past_end, sizeof(past_end), slave_, LED_COUNT));
+    EXPECT_FALSE(led_frame_decode(truncated, sizeof(truncated), slave_, LED_COUNT));
+    EXPECT_FALSE(led_frame_decode(empty, sizeof(empty), slave_, LED_COUNT));
+    EXPECT_FALSE(led_frame_decode(empty, 1, slave_, LED_COUNT));
+    expect_synced();
+}
@@ -0,0 +1,248 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include <string.h>
+
+#include "crc.h"
+#include "loopback.h"
+#include "serial.h"
+#include "serial_protocol.h"
+
+#define sizeof_member(type, member) sizeof(((type *)NULL)->member)
+
+#define trans_initiator2target_initializer_cb(member, cb) \
+    { sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), 0, 0, cb }
+#define trans_initiator2target_initializer(member) trans_initiator2target_initializer_cb(member, NULL)
+
+#define trans_target2initiator_initializer(member) \
+    { 0, 0, sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), NULL }
+
+loopback_stats_t      loopback_stats;
+split_shared_memory_t loopback_slave_shmem;
+uint32_t              loopback_led_state_callbacks;
+uint8_t               loopback_led_state;
+uint32_t              loopback_encoder_drains;
+
+bool (*loopback_handlers_master)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+static void led_state_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    loopback_led_state_callbacks++;
+    loopback_led_state = *(const uint8_t *)initiator2target_buffer;
+}
+
+// Drops the queued encoder events, like encoder_signal_queue_drain()
+static void encoder_drain_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    loopback_encoder_drains++;
+    split_shmem->encoders.events.tail     = split_shmem->encoders.events.head;
+    split_shmem->encoders.events.dequeued = split_shmem->encoders.events.enqueued;
+    split_shmem->encoders.checksum        = crc8(&split_shmem->encoders.events, sizeof(split_shmem->encoders.events));
+}
+
+static void rpc_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {}
+
+// The subset of transactions.c this test needs
+split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
+    [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum),
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+    [GET_ENCODERS_CHECKSUM]     = trans_target2initiator_initializer(encoders.checksum),
+    [GET_ENCODERS_DATA]         = trans_target2initiator_initializer(encoders.events),
+    [CMD_ENCODER_DRAIN]         = {0, 0, 0, 0, encoder_drain_callback},
+    [PUT_SYNC_TIMER]            = trans_initiator2target_initializer(sync_timer),
+    [PUT_LAYER_STATE]           = trans_initiator2target_initializer(layers.layer_state),
+    [PUT_DEFAULT_LAYER_STATE]   = trans_initiator2target_initializer(layers.default_layer_state),
+    [PUT_LED_STATE]             = trans_initiator2target_initializer_cb(led_state, led_state_callback),
+    [PUT_MODS]                  = trans_initiator2target_initializer(mods),
+    [PUT_RPC_INFO]              = trans_initiator2target_initializer_cb(rpc_info, rpc_callback),
+    [PUT_RPC_REQ_DATA]          = trans_initiator2target_initializer(rpc_m2s_buffer),
+    [EXECUTE_RPC]               = trans_initiator2target_initializer(rpc_info.payload.transaction_id),
+    [GET_RPC_RESP_DATA]         = trans_target2initiator_initializer(rpc_s2m_buffer),
+};
+
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    return loopback_handlers_master ? loopback_handlers_master(master_matrix, slave_matrix) : true;
+}
+
+void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {}
+
+void soft_serial_initiator_init(void) {}
+void soft_serial_target_init(void) {}
+
+////////////////////////////////////////////////////
+// Serial driver
+
+typedef struct {
+    uint8_t  data[sizeof(split_shared_memory_t) * 2 + 16];
+    uint16_t head;
+    uint16_t tail;
+} loopback_queue_t;
+
+static loopback_queue_t to_slave;
+static loopback_queue_t to_master;
+static bool             on_slave;
+static bool             disconnected;
+static int32_t          corrupt_request = -1;
+static int32_t          corrupt_reply   = -1;
+
+static void swap_shmem(void) {
+    split_shared_memory_t temp;
+    memcpy(&temp, split_shmem, sizeof(temp));
+    memcpy(split_shmem, &loopback_slave_shmem, sizeof(temp));
+    memcpy(&loopback_slave_shmem, &temp, sizeof(temp));
+}
+
+static uint16_t queue_available(const loopback_queue_t *queue) {
+    return queue->head - queue->tail;
+}
+
+// What serial_protocol.c does on the slave, until everything the master sent is answered
+static void run_slave(void) {
+    if (disconnected) {
+        // Nobody listens
+        to_slave.head = to_slave.tail = 0;
+        return;
+    }
+
+    swap_shmem();
+    on_slave = true;
+    while (queue_available(&to_slave)) {
+        uint8_t transaction_id;
+        serial_transport_receive_blocking(&transaction_id, sizeof(transaction_id));
+#ifdef SPLIT_TRANSPORT_BATCH
+        bool batch = (transaction_id & ~SERIAL_BATCH_FLAGS) == SERIAL_BATCH_TRANSACTION_ID;
+        if (!batch || !loopback_serial_batch_react(transaction_id)) {
+            serial_transport_driver_clear();
+        }
+#else
+        serial_transport_driver_clear();
+#endif
+    }
+    on_slave = false;
+    swap_shmem();
+}
+
+void serial_transport_driver_clear(void) {
+    loopback_queue_t *queue = on_slave ? &to_slave : &to_master;
+    queue->head             = queue->tail = 0;
+}
+
+void serial_transport_driver_slave_init(void) {}
+void serial_transport_driver_master_init(void) {}
+
+bool serial_transport_send(const uint8_t *source, const size_t size) {
+    loopback_queue_t *queue = on_slave ? &to_master : &to_slave;
+    if (queue->head + size > sizeof(queue->data)) {
+        return false;
+    }
+
+    memcpy(&queue->data[queue->head], source, size);
+    int32_t *corrupt = on_slave ? &corrupt_reply : &corrupt_request;
+    if (*corrupt >= 0) {
+        if (*corrupt < (int32_t)size) {
+            queue->data[queue->head + *corrupt] ^= 0x10;
+            *corrupt = -1;
+        } else {
+            *corrupt -= size;
+        }
+    }
+    queue->head += size;
+    loopback_stats.bytes += size;
+    return true;
+}
+
+bool serial_transport_receive(uint8_t *destination, const size_t size) {
+    loopback_queue_t *queue = on_slave ? &to_slave : &to_master;
+    if (!on_slave && queue_available(queue) < size && queue_available(&to_slave)) {
+        // The master turns the line around and waits for the slave
+        loopback_stats.exchanges++;
+        run_slave();
+    }
+    if (queue_available(queue) < size) {
+        // Timeout
+        return false;
+    }
+
+    memcpy(destination, &queue->data[queue->tail], size);
+    queue->tail += size;
+    if (queue->tail == queue->head) {
+        queue->head = queue->tail = 0;
+    }
+    return true;
+}
+
+bool serial_transport_receive_blocking(uint8_t *destination, const size_t size) {
+    return serial_transport_receive(destination, size);
+}
+
+#ifdef SPLIT_TRANSPORT_PUSH
+bool serial_transport_available(void) {
+    return queue_available(on_slave ? &to_slave : &to_master);
+}
+#endif
+
+////////////////////////////////////////////////////
+// Individual transactions, as in serial_protocol.c
+
+bool soft_serial_transaction(int index) {
+    split_transaction_desc_t *trans = &split_transaction_table[index];
+
+#ifdef SPLIT_TRANSPORT_PUSH
+    soft_serial_push_poll();
+#endif
+
+    loopback_stats.exchanges += trans->target2initiator_buffer_size ? 2 : 1;
+    loopback_stats.bytes += 2 + trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+    if (disconnected) {
+        return false;
+    }
+
+    memcpy((uint8_t *)&loopback_slave_shmem + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    swap_shmem();
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+    swap_shmem();
+    memcpy(split_trans_target2initiator_buffer(trans), (uint8_t *)&loopback_slave_shmem + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+    return true;
+}
+
+////////////////////////////////////////////////////
+// Test controls
+
+void loopback_reset(void) {
+    memset(&loopback_stats, 0, sizeof(loopback_stats));
+    memset(split_shmem, 0, sizeof(split_shared_memory_t));
+    memset(&loopback_slave_shmem, 0, sizeof(loopback_slave_shmem));
+    memset(&to_slave, 0, sizeof(to_slave));
+    memset(&to_master, 0, sizeof(to_master));
+    loopback_led_state_callbacks = 0;
+    loopback_led_state           = 0;
+    loopback_encoder_drains      = 0;
+    loopback_handlers_master     = NULL;
+    disconnected                 = false;
+    corrupt_request              = -1;
+    corrupt_reply                = -1;
+}
+
+#ifdef SPLIT_TRANSPORT_PUSH
+bool loopback_slave_push(bool full) {
+    swap_shmem();
+    on_slave  = true;
+    bool okay = loopback_soft_serial_push(full);
+    on_slave  = false;
+    swap_shmem();
+    return okay;
+}
+#endif
+
+void loopback_disconnect(bool state) {
+    disconnected = state;
+}
+
+void loopback_corrupt_request(uint16_t offset) {
+    corrupt_request = offset;
+}
+
+void loopback_corrupt_reply(uint16_t offset) {
+    corrupt_reply = offset;
+}
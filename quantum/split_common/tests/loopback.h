@@ -0,0 +1,53 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "transactions.h"
+
+/* Both halves of a split keyboard in one process. The serial driver is a pair
+ * of queues, and the slave reacts to whatever the master sent as soon as the
+ * master waits for an answer. Each half has its own copy of the shared memory,
+ * swapped in for the slave while it runs. */
+
+typedef struct {
+    uint32_t exchanges; // round trips on the wire
+    uint32_t bytes;     // bytes on the wire, both directions
+} loopback_stats_t;
+
+extern loopback_stats_t      loopback_stats;
+extern split_shared_memory_t loopback_slave_shmem;
+
+// Number of times the LED state callback ran on the slave, and what it saw
+extern uint32_t loopback_led_state_callbacks;
+extern uint8_t  loopback_led_state;
+// Number of times the slave drained its encoder events
+extern uint32_t loopback_encoder_drains;
+
+// Run by transactions_master(), in place of the handlers of transactions.c
+extern bool (*loopback_handlers_master)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+// serial_batch_react() of the slave, see loopback_slave.c
+bool loopback_serial_batch_react(uint8_t transaction_id);
+
+#ifdef SPLIT_TRANSPORT_PUSH
+// soft_serial_push() of the slave, see loopback_slave.c
+bool loopback_soft_serial_push(bool full);
+#endif
+
+void loopback_reset(void);
+
+#ifdef SPLIT_TRANSPORT_PUSH
+// The slave pushes what changed in its shared memory, or all of it
+bool loopback_slave_push(bool full);
+#endif
+
+// The slave stops answering
+void loopback_disconnect(bool disconnected);
+
+// Flip a bit of a byte the master or the slave sends, counting from the start of its next frame
+void loopback_corrupt_request(uint16_t offset);
+void loopback_corrupt_reply(uint16_t offset);
@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Each half keeps its own state of the batch and push protocols, so the slave gets a copy of them
+#define soft_serial_batch_transaction loopback_soft_serial_batch_transaction
+#define serial_batch_react loopback_serial_batch_react
+#define soft_serial_push loopback_soft_serial_push
+#define soft_serial_push_poll loopback_soft_serial_push_poll
+#define soft_serial_push_read loopback_soft_serial_push_read
+#define serial_push_receive loopback_serial_push_receive
+
+#include "serial_protocol_batch.c"
+#include "serial_protocol_push.c"
@@ -0,0 +1,68 @@
+# Both halves on a loopback serial driver, with a few of the transactions of transactions.c
+SPLIT_TRANSPORT_BATCH_DEFS := -DSPLIT_KEYBOARD -DSPLIT_TRANSPORT_BATCH -DSERIAL_DRIVER_USART \
+	-DMATRIX_ROWS=10 -DMATRIX_COLS=6 \
+	-DENCODER_ENABLE -DNUM_ENCODERS_LEFT=1 -DNUM_ENCODERS_RIGHT=1 \
+	-DSPLIT_LAYER_STATE_ENABLE -DSPLIT_LED_STATE_ENABLE -DSPLIT_MODS_ENABLE \
+	-DSPLIT_TRANSACTION_IDS_USER=USER_SYNC
+
+SPLIT_TRANSPORT_BATCH_INC := $(QUANTUM_PATH)/split_common \
+	$(PLATFORM_PATH)/chibios/drivers
+
+SPLIT_TRANSPORT_BATCH_SRC := $(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/transaction_schedule.c \
+	$(PLATFORM_PATH)/chibios/drivers/serial_protocol_batch.c \
+	$(PLATFORM_PATH)/synchronization_util.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/tests/loopback.c \
+	$(QUANTUM_PATH)/split_common/tests/loopback_slave.c
+
+split_transport_batch_DEFS := $(SPLIT_TRANSPORT_BATCH_DEFS)
+split_transport_batch_INC := $(SPLIT_TRANSPORT_BATCH_INC)
+split_transport_batch_SRC := $(SPLIT_TRANSPORT_BATCH_SRC) \
+	$(QUANTUM_PATH)/split_common/tests/transport_batch_tests.cpp
+
+split_transport_batch_benchmark_DEFS := $(SPLIT_TRANSPORT_BATCH_DEFS)
+split_transport_batch_benchmark_INC := $(SPLIT_TRANSPORT_BATCH_INC)
+split_transport_batch_benchmark_SRC := $(SPLIT_TRANSPORT_BATCH_SRC) \
+	$(QUANTUM_PATH)/split_common/tests/transport_batch_benchmark.cpp
+
+split_transport_push_DEFS := -DSPLIT_KEYBOARD -DSPLIT_TRANSPORT_PUSH -DSERIAL_DRIVER_USART \
+	-DMATRIX_ROWS=10 -DMATRIX_COLS=6 \
+	-DENCODER_ENABLE -DNUM_ENCODERS_LEFT=1 -DNUM_ENCODERS_RIGHT=1 \
+	-DSPLIT_LAYER_STATE_ENABLE -DSPLIT_LED_STATE_ENABLE -DSPLIT_MODS_ENABLE \
+	-DSPLIT_TRANSACTION_IDS_USER=USER_SYNC
+split_transport_push_INC := $(SPLIT_TRANSPORT_BATCH_INC)
+split_transport_push_SRC := $(QUANTUM_PATH)/split_common/transport.c \
+	$(PLATFORM_PATH)/chibios/drivers/serial_protocol_push.c \
+	$(PLATFORM_PATH)/synchronization_util.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/tests/loopback.c \
+	$(QUANTUM_PATH)/split_common/tests/loopback_slave.c \
+	$(QUANTUM_PATH)/split_common/tests/transport_push_tests.cpp
+
+split_transaction_stats_DEFS := -DSPLIT_KEYBOARD -DSPLIT_TRANSACTION_STATS -DMATRIX_ROWS=10 -DMATRIX_COLS=6
+split_transaction_stats_INC := $(QUANTUM_PATH)/split_common
+split_transaction_stats_SRC := $(QUANTUM_PATH)/split_common/transaction_stats.c \
+	$(QUANTUM_PATH)/split_common/transaction_schedule.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/split_common/tests/transaction_stats_tests.cpp
+
+split_led_frame_INC := $(QUANTUM_PATH)/split_common
+split_led_frame_SRC := $(QUANTUM_PATH)/split_common/led_frame.c \
+	$(QUANTUM_PATH)/split_common/tests/led_frame_tests.cpp
+
+split_transaction_stream_DEFS := -DSPLIT_TRANSACTION_STREAM
+split_transaction_stream_INC := $(QUANTUM_PATH)/split_common
+split_transaction_stream_SRC := $(QUANTUM_PATH)/split_common/transaction_stream.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/tests/transaction_stream_tests.cpp
+
+# The largest chunk which still fits in a transaction
+split_transaction_stream_max_chunk_DEFS := -DSPLIT_TRANSACTION_STREAM -DSPLIT_STREAM_CHUNK_SIZE=248 -DSPLIT_STREAM_BUFFER_SIZE=2048
+split_transaction_stream_max_chunk_INC := $(split_transaction_stream_INC)
+split_transaction_stream_max_chunk_SRC := $(split_transaction_stream_SRC)
@@ -0,0 +1,10 @@
+TEST_LIST += \
+	split_transport_batch \
+	split_transport_push \
+	split_transaction_stats \
+	split_led_frame \
+	split_transaction_stream \
+	split_transaction_stream_max_chunk
+
+BENCHMARK_LIST += \
+	split_transport_batch_benchmark
@@ -0,0 +1,132 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+// For the C headers of split_common
+#define _Static_assert static_assert
+
+extern "C" {
+#include "transaction_stats.h"
+#include "transaction_id_define.h"
+
+void advance_time(uint32_t ms);
+}
+
+class TransactionStats : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        split_transaction_stats_reset();
+        schedule_ = {};
+    }
+
+    void fail(int times) {
+        for (int i = 0; i < times; i++) {
+            split_transaction_record(GET_SLAVE_MATRIX_DATA, false, split_transaction_timestamp());
+        }
+    }
+
+    void succeed(int times) {
+        for (int i = 0; i < times; i++) {
+            split_transaction_record(GET_SLAVE_MATRIX_DATA, true, split_transaction_timestamp());
+        }
+    }
+
+    split_handler_schedule_t schedule_;
+};
+
+TEST_F(TransactionStats, FailedHandlersAreRetriedInTheNextScan) {
+    EXPECT_EQ(split_handler_schedule_check(&schedule_), SPLIT_HANDLER_RUN);
+    split_handler_schedule_update(&schedule_, false, false);
+    EXPECT_EQ(split_handler_schedule_check(&schedule_), SPLIT_HANDLER_RUN);
+}
+
+TEST_F(TransactionStats, RetryDelayDoubles) {
+    split_handler_schedule_update(&schedule_, false, false);
+
+    uint32_t delays[] = {1, 2, 4, 8, 16, 32, 32, 32};
+    for (uint32_t delay : delays) {
+        split_handler_schedule_update(&schedule_, false, false);
+        advance_time(delay - 1);
+        EXPECT_EQ(split_handler_schedule_check(&schedule_), SPLIT_HANDLER_DEFERRED) << "delay " << delay;
+        advance_time(1);
+        EXPECT_EQ(split_handler_schedule_check(&schedule_), SPLIT_HANDLER_RUN) << "delay " << delay;
+    }
+
+    split_handler_schedule_update(&schedule_, true, false);
+    EXPECT_EQ(schedule_.failures, 0);
+    EXPECT_EQ(split_handler_schedule_check(&schedule_), SPLIT_HANDLER_RUN);
+}
+
+TEST_F(TransactionStats, LinkQualityFollowsFailures) {
+    EXPECT_EQ(split_link_quality(), 255);
+    EXPECT_FALSE(split_link_degraded());
+
+    fail(3);
+    EXPECT_TRUE(split_link_degraded());
+
+    succeed(3);
+    EXPECT_FALSE(split_link_degraded());
+
+    succeed(100);
+    EXPECT_EQ(split_link_quality(), 255);
+}
+
+TEST_F(TransactionStats, LowPriorityHandlersAreThrottledOnADegradedLink) {
+    split_handler_schedule_update(&schedule_, true, true);
+    EXPECT_EQ(split_handler_schedule_check(&schedule_), SPLIT_HANDLER_RUN);
+
+    fail(3);
+    split_handler_schedule_update(&schedule_, true, false);
+    EXPECT_EQ(split_handler_schedule_check(&schedule_), SPLIT_HANDLER_RUN);
+
+    split_handler_schedule_update(&schedule_, true, true);
+    advance_time(SPLIT_LINK_DEGRADED_THROTTLE_MS - 1);
+    EXPECT_EQ(split_handler_schedule_check(&schedule_), SPLIT_HANDLER_THROTTLED);
+    advance_time(1);
+    EXPECT_EQ(split_handler_schedule_check(&schedule_), SPLIT_HANDLER_RUN);
+}
+
+TEST_F(TransactionStats, CountsAttemptsAndErrors) {
+    succeed(5);
+    fail(2);
+
+    const split_transaction_stats_t *stats = split_transaction_stats_get(GET_SLAVE_MATRIX_DATA);
+    ASSERT_NE(stats, nullptr);
+    EXPECT_EQ(stats->count, 7U);
+    EXPECT_EQ(stats->errors, 2U);
+    EXPECT_EQ(split_transaction_stats_get(GET_SLAVE_MATRIX_CHECKSUM)->count, 0U);
+    EXPECT_EQ(split_transaction_stats_get(NUM_TOTAL_TRANSACTIONS), nullptr);
+
+    split_transaction_stats_reset();
+    EXPECT_EQ(stats->count, 0U);
+    EXPECT_EQ(split_link_quality(), 255);
+}
+
+TEST_F(TransactionStats, RecordsLatency) {
+    uint32_t start = split_transaction_timestamp();
+    advance_time(3);
+    split_transaction_record(GET_SLAVE_MATRIX_DATA, true, start);
+
+    const split_transaction_stats_t *stats = split_transaction_stats_get(GET_SLAVE_MATRIX_DATA);
+    EXPECT_EQ(stats->last_us, 3000U);
+    EXPECT_EQ(stats->max_us, 3000U);
+    EXPECT_EQ(stats->total_us, 3000U);
+
+    split_transaction_record(GET_SLAVE_MATRIX_DATA, true, split_transaction_timestamp());
+    EXPECT_EQ(stats->last_us, 0U);
+    EXPECT_EQ(stats->max_us, 3000U);
+}
+
+TEST_F(TransactionStats, ReadRaw) {
+    fail(1);
+
+    uint8_t data[64];
+    EXPECT_EQ(split_transaction_stats_read_raw(GET_SLAVE_MATRIX_DATA, 0, data, sizeof(data)), sizeof(split_transaction_stats_t));
+    EXPECT_EQ(memcmp(data, split_transaction_stats_get(GET_SLAVE_MATRIX_DATA), sizeof(split_transaction_stats_t)), 0);
+
+    EXPECT_EQ(split_transaction_stats_read_raw(GET_SLAVE_MATRIX_DATA, 4, data, 2), 2);
+    EXPECT_EQ(data[0], 1);
+    EXPECT_EQ(split_transaction_stats_read_raw(GET_SLAVE_MATRIX_DATA, sizeof(split_transaction_stats_t), data, sizeof(data)), 0);
+    EXPECT_EQ(split_transaction_stats_read_raw(NUM_TOTAL_TRANSACTIONS, 0, data, sizeof(data)), 0);
+}
@@ -0,0 +1,177 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <functional>
+#include <vector>
+#include "gtest/gtest.h"
+
+#define _Static_assert static_assert
+
+extern "C" {
+#include "transaction_stream.h"
+}
+
+#define STREAM_ID 42
+
+static std::vector<uint8_t> received;
+static int                  completions;
+
+static void on_stream(int8_t transaction_id, uint16_t length, const void *data) {
+    EXPECT_EQ(transaction_id, STREAM_ID);
+    received.assign((const uint8_t *)data, (const uint8_t *)data + length);
+    completions++;
+}
+
+class TransactionStream : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        received.clear();
+        completions = 0;
+    }
+
+    // Runs scans the way the master handler does, until the stream is no longer being sent
+    split_stream_status_t run(split_stream_callback_t callback = on_stream, int max_scans = 1000) {
+        for (int scan = 0; scan < max_scans && split_stream_status() == SPLIT_STREAM_SENDING; scan++) {
+            if (split_stream_ack_due()) {
+                split_stream_ack_t ack = ack_;
+                if (fail_ack && fail_ack(acks_read_++)) {
+                    split_stream_send_failed();
+                    continue;
+                }
+                split_stream_ack(&ack);
+            }
+            split_stream_chunk_t chunk;
+            while (split_stream_next_chunk(&chunk)) {
+                uint16_t n = chunks_sent_++;
+                if (corrupt && corrupt(n)) {
+                    chunk.data[0] ^= 0xFF;
+                }
+                if (drop && drop(n)) {
+                    continue;
+                }
+                split_stream_receive(&chunk, callback, &ack_);
+            }
+        }
+        return split_stream_status();
+    }
+
+    std::vector<uint8_t> payload(uint16_t length) {
+        std::vector<uint8_t> data(length);
+        for (uint16_t i = 0; i < length; i++) {
+            data[i] = i * 7 + 3;
+        }
+        return data;
+    }
+
+    std::function<bool(uint16_t)> drop;
+    std::function<bool(uint16_t)> corrupt;
+    std::function<bool(uint16_t)> fail_ack;
+
+    split_stream_ack_t ack_         = {};
+    uint16_t           chunks_sent_ = 0;
+    uint16_t           acks_read_   = 0;
+};
+
+TEST_F(TransactionStream, DeliversInOrder) {
+    auto data = payload(200);
+    EXPECT_TRUE(split_stream_start(STREAM_ID, data.data(), data.size()));
+    EXPECT_EQ(run(), SPLIT_STREAM_DONE);
+    EXPECT_EQ(completions, 1);
+    EXPECT_EQ(received, data);
+    EXPECT_EQ(chunks_sent_, (200 + SPLIT_STREAM_CHUNK_SIZE - 1) / SPLIT_STREAM_CHUNK_SIZE);
+}
+
+TEST_F(TransactionStream, ZeroLength) {
+    EXPECT_TRUE(split_stream_start(STREAM_ID, NULL, 0));
+    EXPECT_EQ(run(), SPLIT_STREAM_DONE);
+    EXPECT_EQ(completions, 1);
+    EXPECT_TRUE(received.empty());
+}
+
+TEST_F(TransactionStream, OneStreamAtATime) {
+    auto data = payload(100);
+    EXPECT_TRUE(split_stream_start(STREAM_ID, data.data(), data.size()));
+    EXPECT_FALSE(split_stream_start(STREAM_ID, data.data(), data.size()));
+    EXPECT_EQ(run(), SPLIT_STREAM_DONE);
+}
+
+TEST_F(TransactionStream, ChunkFitsInATransaction) {
+    EXPECT_LE(sizeof(split_stream_chunk_t), UINT8_MAX);
+}
+
+TEST_F(TransactionStream, TooLongForTheSlave) {
+    EXPECT_FALSE(split_stream_start(STREAM_ID, NULL, SPLIT_STREAM_BUFFER_SIZE + 1));
+}
+
+TEST_F(TransactionStream, ResendsDroppedChunks) {
+    auto data = payload(SPLIT_STREAM_BUFFER_SIZE);
+    drop      = [](uint16_t n) { return n % 3 == 1; };
+    EXPECT_TRUE(split_stream_start(STREAM_ID, data.data(), data.size()));
+    EXPECT_EQ(run(), SPLIT_STREAM_DONE);
+    EXPECT_EQ(completions, 1);
+    EXPECT_EQ(received, data);
+}
+
+TEST_F(TransactionStream, ResendsCorruptedChunks) {
+    auto data = payload(150);
+    corrupt   = [](uint16_t n) { return n == 0 || n == 4; };
+    EXPECT_TRUE(split_stream_start(STREAM_ID, data.data(), data.size()));
+    EXPECT_EQ(run(), SPLIT_STREAM_DONE);
+    EXPECT_EQ(completions, 1);
+    EXPECT_EQ(received, data);
+}
+
+TEST_F(TransactionStream, SurvivesLostAcknowledgements) {
+    auto data = payload(180);
+    fail_ack  = [](uint16_t n) { return n % 2 == 0; };
+    EXPECT_TRUE(split_stream_start(STREAM_ID, data.data(), data.size()));
+    EXPECT_EQ(run(), SPLIT_STREAM_DONE);
+    EXPECT_EQ(completions, 1);
+    EXPECT_EQ(received, data);
+}
+
+TEST_F(TransactionStream, GivesUpOnADeadLink) {
+    auto data = payload(100);
+    drop      = [](uint16_t) { return true; };
+    EXPECT_TRUE(split_stream_start(STREAM_ID, data.data(), data.size()));
+    EXPECT_EQ(run(), SPLIT_STREAM_FAILED);
+    EXPECT_EQ(completions, 0);
+}
+
+TEST_F(TransactionStream, GivesUpWithoutAcknowledgements) {
+    auto data = payload(100);
+    fail_ack  = [](uint16_t) { return true; };
+    EXPECT_TRUE(split_stream_start(STREAM_ID, data.data(), data.size()));
+    EXPECT_EQ(run(), SPLIT_STREAM_FAILED);
+    // The slave got every chunk, the master just never found out
+    EXPECT_EQ(completions, 1);
+}
+
+TEST_F(TransactionStream, RejectedWithoutCallback) {
+    // more than a window of chunks
+    auto data = payload(SPLIT_STREAM_CHUNK_SIZE * (SPLIT_STREAM_WINDOW + 1));
+    EXPECT_TRUE(split_stream_start(STREAM_ID, data.data(), data.size()));
+    EXPECT_EQ(run(NULL), SPLIT_STREAM_FAILED);
+    EXPECT_EQ(completions, 0);
+    // Stopped at the first acknowledgement
+    EXPECT_EQ(chunks_sent_, SPLIT_STREAM_WINDOW);
+}
+
+TEST_F(TransactionStream, ConsecutiveStreams) {
+    auto first  = payload(70);
+    auto second = payload(40);
+    second[0]   = 0xAA;
+    EXPECT_TRUE(split_stream_start(STREAM_ID, first.data(), first.size()));
+    EXPECT_EQ(run(), SPLIT_STREAM_DONE);
+    EXPECT_EQ(received, first);
+
+    // A stale acknowledgement of the first stream doesn't complete the second one
+    EXPECT_TRUE(split_stream_start(STREAM_ID, second.data(), second.size()));
+    drop = [](uint16_t) { return true; };
+    run(on_stream, 1);
+    EXPECT_EQ(split_stream_status(), SPLIT_STREAM_SENDING);
+    drop = nullptr;
+    EXPECT_EQ(run(), SPLIT_STREAM_DONE);
+    EXPECT_EQ(completions, 2);
+    EXPECT_EQ(received, second);
+}
@@ -0,0 +1,159 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Link cost of batched split transactions, against running each of them on
+ * its own. Run with:
+ *
+ *     make bench:split_transport_batch_benchmark
+ *
+ * The handlers below follow transactions.c for the slave matrix, an encoder and
+ * the usual state of the master half, with one scan per millisecond.
+ * Batched exchanges are measured on the loopback driver, individual ones are
+ * counted the way initiate_transaction() in serial_protocol.c runs them. Link
+ * time assumes 10 bits per byte at SERIAL_USART_SPEED, and a fixed cost for
+ * every time the line turns around, for the other half to wake up and answer.
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+
+// For the C headers of split_common
+#define _Static_assert static_assert
+
+extern "C" {
+#include "crc.h"
+#include "loopback.h"
+#include "transport.h"
+}
+
+#define SCANS 60000
+#define FORCED_SYNC_SCANS 100
+
+#define SERIAL_USART_SPEED 460800
+#define TURNAROUND_US 20
+
+typedef struct {
+    uint64_t exchanges;
+    uint64_t bytes;
+} link_cost_t;
+
+static link_cost_t  individual;
+static uint32_t     now;
+static matrix_row_t last_matrix[MATRIX_ROWS / 2];
+static uint8_t      layer;
+static uint8_t      mods;
+static uint8_t      led_state;
+static uint32_t     encoder_events;
+
+static bool transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    const split_transaction_desc_t *trans = &split_transaction_table[id];
+    individual.exchanges += trans->target2initiator_buffer_size ? 2 : 1;
+    individual.bytes += 2 + trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+    return transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+}
+
+static bool send_if_condition(int8_t id, uint32_t *last_update, bool condition, const void *source, size_t length) {
+    if (now - *last_update < FORCED_SYNC_SCANS && !condition) {
+        return true;
+    }
+    *last_update = now;
+    return transaction(id, source, length, NULL, 0);
+}
+
+static bool handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t last_matrix_update, last_encoders_update, last_sync_timer_update, last_layer_update, last_default_layer_update, last_led_state_update, last_mods_update;
+    static uint8_t  sent_layer, sent_mods, sent_led_state, last_encoders_checksum;
+
+    uint8_t checksum;
+    bool    okay = transaction(GET_SLAVE_MATRIX_CHECKSUM, NULL, 0, &checksum, sizeof(checksum));
+    if (okay && (now - last_matrix_update >= FORCED_SYNC_SCANS || checksum != crc8(last_matrix, sizeof(last_matrix)))) {
+        okay &= transaction(GET_SLAVE_MATRIX_DATA, NULL, 0, last_matrix, sizeof(last_matrix));
+        last_matrix_update = now;
+    }
+
+    encoder_events_t events;
+    okay &= transaction(GET_ENCODERS_CHECKSUM, NULL, 0, &checksum, sizeof(checksum));
+    if (okay && (now - last_encoders_update >= FORCED_SYNC_SCANS || checksum != crc8(&split_shmem->encoders.events, sizeof(events)))) {
+        okay &= transaction(GET_ENCODERS_DATA, NULL, 0, &events, sizeof(events));
+        last_encoders_update = now;
+    }
+    if (okay && checksum != last_encoders_checksum) {
+        if (split_shmem->encoders.events.dequeued != split_shmem->encoders.events.enqueued) {
+            encoder_events++;
+            okay &= transaction(CMD_ENCODER_DRAIN, NULL, 0, NULL, 0);
+        }
+        last_encoders_checksum = checksum;
+    }
+
+    uint32_t sync_timer = now;
+    okay &= send_if_condition(PUT_SYNC_TIMER, &last_sync_timer_update, false, &sync_timer, sizeof(sync_timer));
+
+    layer_state_t layer_state = (layer_state_t)1 << layer, default_layer_state = 1;
+    okay &= send_if_condition(PUT_LAYER_STATE, &last_layer_update, layer != sent_layer, &layer_state, sizeof(layer_state));
+    okay &= send_if_condition(PUT_DEFAULT_LAYER_STATE, &last_default_layer_update, false, &default_layer_state, sizeof(default_layer_state));
+    okay &= send_if_condition(PUT_LED_STATE, &last_led_state_update, led_state != sent_led_state, &led_state, sizeof(led_state));
+
+    split_mods_sync_t mods_sync = {.real_mods = mods};
+    okay &= send_if_condition(PUT_MODS, &last_mods_update, mods != sent_mods, &mods_sync, sizeof(mods_sync));
+
+    sent_layer     = layer;
+    sent_mods      = mods;
+    sent_led_state = led_state;
+    return okay;
+}
+
+static double link_us(uint64_t exchanges, uint64_t bytes) {
+    return exchanges * TURNAROUND_US + bytes * 10 * 1e6 / SERIAL_USART_SPEED;
+}
+
+TEST(TransportBatchBenchmark, LinkCost) {
+    loopback_reset();
+    loopback_handlers_master = handlers_master;
+    individual               = {};
+
+    matrix_row_t master_matrix[MATRIX_ROWS / 2];
+    matrix_row_t slave_matrix[MATRIX_ROWS / 2];
+    uint32_t     seed = 1;
+
+    for (now = 0; now < SCANS; now++) {
+        // Typing on the slave half, a key goes down or up every 60ms
+        if (now % 60 == 0) {
+            seed = seed * 1103515245 + 12345;
+            loopback_slave_shmem.smatrix.matrix[(seed >> 16) % (MATRIX_ROWS / 2)] ^= 1 << ((seed >> 8) % MATRIX_COLS);
+            loopback_slave_shmem.smatrix.checksum = crc8(loopback_slave_shmem.smatrix.matrix, sizeof(loopback_slave_shmem.smatrix.matrix));
+        }
+        // An encoder on the slave half is turned every 300ms
+        if (now % 300 == 150) {
+            encoder_events_t *events    = &loopback_slave_shmem.encoders.events;
+            events->queue[events->head] = {.index = 1, .clockwise = 1};
+            events->head                = (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
+            events->enqueued++;
+            loopback_slave_shmem.encoders.checksum = crc8(events, sizeof(*events));
+        }
+        // Modifiers, layers and host LEDs change on the master half
+        if (now % 250 == 0) {
+            mods ^= 0x02;
+        }
+        if (now % 500 == 0) {
+            layer = (layer + 1) % 4;
+        }
+        if (now % 5000 == 0) {
+            led_state ^= 0x02;
+        }
+
+        EXPECT_TRUE(transport_master(master_matrix, slave_matrix));
+    }
+
+    EXPECT_EQ(memcmp(last_matrix, loopback_slave_shmem.smatrix.matrix, sizeof(last_matrix)), 0);
+    EXPECT_EQ(loopback_slave_shmem.mods.real_mods, mods);
+    EXPECT_EQ(encoder_events, SCANS / 300);
+    EXPECT_EQ(loopback_encoder_drains, encoder_events);
+
+    double individual_us = link_us(individual.exchanges, individual.bytes) / SCANS;
+    double batched_us    = link_us(loopback_stats.exchanges, loopback_stats.bytes) / SCANS;
+    printf("split transport benchmark: individual: %.2f exchanges, %.2f bytes, %.1f us per scan\n", (double)individual.exchanges / SCANS, (double)individual.bytes / SCANS, individual_us);
+    printf("split transport benchmark: batched:    %.2f exchanges, %.2f bytes, %.1f us per scan\n", (double)loopback_stats.exchanges / SCANS, (double)loopback_stats.bytes / SCANS, batched_us);
+    EXPECT_LT(batched_us, individual_us);
+}
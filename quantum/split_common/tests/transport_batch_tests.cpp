@@ -0,0 +1,173 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+// For the C headers of split_common
+#define _Static_assert static_assert
+
+extern "C" {
+#include "crc.h"
+#include "loopback.h"
+#include "transport.h"
+#include "transaction_stats.h"
+}
+
+// Size of a frame with buffers of the given size
+#define FRAME_BYTES(size) (1 + SPLIT_BATCH_DIRTY_SIZE + (size) + 1)
+
+static uint8_t      led_state;
+static matrix_row_t matrix[MATRIX_ROWS / 2];
+static uint8_t      checksum;
+
+static bool read_slave_matrix(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    return transport_execute_transaction(GET_SLAVE_MATRIX_CHECKSUM, NULL, 0, &checksum, sizeof(checksum)) && transport_execute_transaction(GET_SLAVE_MATRIX_DATA, NULL, 0, matrix, sizeof(matrix));
+}
+
+static bool write_led_state(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    return transport_execute_transaction(PUT_LED_STATE, &led_state, sizeof(led_state), NULL, 0);
+}
+
+class TransportBatch : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        loopback_reset();
+        // Start from a clean slate, whatever the last test left behind
+        EXPECT_TRUE(scan());
+        loopback_reset();
+        split_link_quality_reset();
+    }
+
+    bool scan(void) {
+        return transport_master(master_matrix_, slave_matrix_);
+    }
+
+    void set_slave_matrix(uint8_t row, matrix_row_t value) {
+        loopback_slave_shmem.smatrix.matrix[row] = value;
+        loopback_slave_shmem.smatrix.checksum    = crc8(loopback_slave_shmem.smatrix.matrix, sizeof(loopback_slave_shmem.smatrix.matrix));
+    }
+
+    matrix_row_t master_matrix_[MATRIX_ROWS / 2];
+    matrix_row_t slave_matrix_[MATRIX_ROWS / 2];
+};
+
+TEST_F(TransportBatch, ReadsTakeOneExchange) {
+    set_slave_matrix(2, 0x15);
+    loopback_handlers_master = read_slave_matrix;
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 1U);
+    EXPECT_EQ(matrix[2], 0x15);
+    EXPECT_EQ(checksum, loopback_slave_shmem.smatrix.checksum);
+}
+
+TEST_F(TransportBatch, WritesReachTheSlaveInTheSameScan) {
+    led_state                = 0x04;
+    loopback_handlers_master = write_led_state;
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 2U);
+    EXPECT_EQ(loopback_slave_shmem.led_state, 0x04);
+    EXPECT_EQ(loopback_led_state_callbacks, 1U);
+    EXPECT_EQ(loopback_led_state, 0x04);
+
+    // Nothing to send, nothing to flush
+    loopback_handlers_master = NULL;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 3U);
+    EXPECT_EQ(loopback_led_state_callbacks, 1U);
+}
+
+TEST_F(TransportBatch, RepliesOnlyCarryChanges) {
+    loopback_handlers_master = read_slave_matrix;
+
+    // Just the transaction id and the handshake
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.bytes, 2U);
+
+    set_slave_matrix(0, 0x01);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.bytes, 2U + 1 + FRAME_BYTES(sizeof(split_slave_matrix_sync_t)));
+    EXPECT_EQ(matrix[0], 0x01);
+}
+
+TEST_F(TransportBatch, MasterCopiesAreRefreshed) {
+    set_slave_matrix(1, 0x22);
+    loopback_handlers_master = read_slave_matrix;
+    EXPECT_TRUE(scan());
+
+    // Like the encoder handler, which dequeues from its copy
+    split_shmem->smatrix.matrix[1] = 0;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(matrix[1], 0x22);
+}
+
+TEST_F(TransportBatch, CorruptedRequestIsSentAgain) {
+    led_state                = 0x02;
+    loopback_handlers_master = write_led_state;
+
+    // The LED state in the flush, after the empty request of the first exchange
+    loopback_corrupt_request(1 + 1 + SPLIT_BATCH_DIRTY_SIZE);
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(loopback_led_state_callbacks, 0U);
+    EXPECT_EQ(loopback_slave_shmem.led_state, 0);
+
+    loopback_handlers_master = NULL;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_led_state_callbacks, 1U);
+    EXPECT_EQ(loopback_led_state, 0x02);
+}
+
+TEST_F(TransportBatch, CorruptedReplyIsSentAgain) {
+    loopback_handlers_master = read_slave_matrix;
+    EXPECT_TRUE(scan());
+
+    // The slave sent the change, but the master never got it
+    set_slave_matrix(4, 0x30);
+    loopback_corrupt_reply(1 + SPLIT_BATCH_DIRTY_SIZE);
+    EXPECT_FALSE(scan());
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(matrix[4], 0x30);
+}
+
+TEST_F(TransportBatch, DisconnectedSlaveIsTriedOnce) {
+    led_state                = 0x01;
+    loopback_handlers_master = [](matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) { return write_led_state(master_matrix, slave_matrix) && read_slave_matrix(master_matrix, slave_matrix); };
+    loopback_disconnect(true);
+
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 1U);
+
+    // The write went nowhere, and goes out with the next exchange
+    loopback_disconnect(false);
+    loopback_handlers_master = NULL;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 2U);
+    EXPECT_EQ(loopback_led_state, 0x01);
+}
+
+TEST_F(TransportBatch, QueuedWritesShareTheOutcomeOfTheExchange) {
+    led_state                = 0x01;
+    loopback_handlers_master = write_led_state;
+    loopback_disconnect(true);
+
+    // Queued, but not sent yet
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(split_link_quality(), UINT8_MAX);
+
+    EXPECT_FALSE(scan());
+    uint8_t degraded = split_link_quality();
+    EXPECT_LT(degraded, UINT8_MAX);
+
+    loopback_disconnect(false);
+    EXPECT_TRUE(scan());
+    EXPECT_GT(split_link_quality(), degraded);
+}
+
+TEST_F(TransportBatch, RpcIsNotBatched) {
+    rpc_sync_info_t info = {.checksum = 0x5A, .payload = {.transaction_id = USER_SYNC, .m2s_length = 0, .s2m_length = 0}};
+
+    EXPECT_TRUE(transport_execute_transaction(PUT_RPC_INFO, &info, sizeof(info), NULL, 0));
+    EXPECT_EQ(loopback_stats.exchanges, 1U);
+    EXPECT_EQ(loopback_slave_shmem.rpc_info.checksum, 0x5A);
+}
@@ -0,0 +1,135 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+// For the C headers of split_common
+#define _Static_assert static_assert
+
+extern "C" {
+#include "crc.h"
+#include "loopback.h"
+#include "timer.h"
+#include "transport.h"
+
+void advance_time(uint32_t ms);
+}
+
+// Size of a frame with buffers of the given size
+#define FRAME_BYTES(size) (1 + SPLIT_PUSH_BITMAP_SIZE + (size) + 1)
+
+static matrix_row_t matrix[MATRIX_ROWS / 2];
+static uint8_t      checksum;
+static uint8_t      led_state;
+
+static bool read_slave_matrix(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    return transport_execute_transaction(GET_SLAVE_MATRIX_CHECKSUM, NULL, 0, &checksum, sizeof(checksum)) && transport_execute_transaction(GET_SLAVE_MATRIX_DATA, NULL, 0, matrix, sizeof(matrix));
+}
+
+class TransportPush : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Start from a clean slate, whatever the last test left behind
+        loopback_reset();
+        EXPECT_TRUE(loopback_slave_push(true));
+        EXPECT_TRUE(scan());
+        loopback_reset();
+        loopback_handlers_master = read_slave_matrix;
+    }
+
+    bool scan(void) {
+        return transport_master(master_matrix_, slave_matrix_);
+    }
+
+    void set_slave_matrix(uint8_t row, matrix_row_t value) {
+        loopback_slave_shmem.smatrix.matrix[row] = value;
+        loopback_slave_shmem.smatrix.checksum    = crc8(loopback_slave_shmem.smatrix.matrix, sizeof(loopback_slave_shmem.smatrix.matrix));
+    }
+
+    matrix_row_t master_matrix_[MATRIX_ROWS / 2];
+    matrix_row_t slave_matrix_[MATRIX_ROWS / 2];
+};
+
+TEST_F(TransportPush, ReadsTakeNoExchange) {
+    set_slave_matrix(3, 0x21);
+    EXPECT_TRUE(loopback_slave_push(false));
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 0U);
+    EXPECT_EQ(matrix[3], 0x21);
+    EXPECT_EQ(checksum, loopback_slave_shmem.smatrix.checksum);
+}
+
+TEST_F(TransportPush, OnlyChangesArePushed) {
+    EXPECT_TRUE(loopback_slave_push(false));
+    EXPECT_EQ(loopback_stats.bytes, 0U);
+
+    set_slave_matrix(0, 0x01);
+    EXPECT_TRUE(loopback_slave_push(false));
+    EXPECT_EQ(loopback_stats.bytes, FRAME_BYTES(sizeof(split_shmem->smatrix.checksum) + sizeof(split_shmem->smatrix.matrix)));
+}
+
+TEST_F(TransportPush, WritesAreNotPushed) {
+    led_state                = 0x04;
+    loopback_handlers_master = [](matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) { return transport_execute_transaction(PUT_LED_STATE, &led_state, sizeof(led_state), NULL, 0); };
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 1U);
+    EXPECT_EQ(loopback_led_state, 0x04);
+}
+
+TEST_F(TransportPush, PushesAreTakenInBeforeTransactions) {
+    set_slave_matrix(1, 0x0C);
+    EXPECT_TRUE(loopback_slave_push(false));
+
+    // The frame is still queued when the master starts a transaction of its own
+    EXPECT_TRUE(transport_execute_transaction(PUT_LED_STATE, &led_state, sizeof(led_state), NULL, 0));
+    EXPECT_TRUE(transport_execute_transaction(GET_SLAVE_MATRIX_DATA, NULL, 0, matrix, sizeof(matrix)));
+    EXPECT_EQ(loopback_stats.exchanges, 1U);
+    EXPECT_EQ(matrix[1], 0x0C);
+}
+
+TEST_F(TransportPush, CorruptedPushFallsBackToPolling) {
+    set_slave_matrix(4, 0x30);
+    loopback_corrupt_reply(1 + SPLIT_PUSH_BITMAP_SIZE);
+    EXPECT_TRUE(loopback_slave_push(false));
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 4U);
+    EXPECT_EQ(matrix[4], 0x30);
+
+    // Changes alone don't make up for the lost frame
+    set_slave_matrix(4, 0x31);
+    EXPECT_TRUE(loopback_slave_push(false));
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 8U);
+
+    // The next heartbeat does
+    EXPECT_TRUE(loopback_slave_push(true));
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 8U);
+    EXPECT_EQ(matrix[4], 0x31);
+}
+
+TEST_F(TransportPush, StrayBytesAreCleared) {
+    set_slave_matrix(2, 0x11);
+    // Not a push frame anymore
+    loopback_corrupt_reply(0);
+    EXPECT_TRUE(loopback_slave_push(false));
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 4U);
+    EXPECT_EQ(matrix[2], 0x11);
+}
+
+TEST_F(TransportPush, SilentSlaveFallsBackToPolling) {
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 0U);
+
+    advance_time(SPLIT_TRANSPORT_PUSH_TIMEOUT);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_stats.exchanges, 4U);
+
+    loopback_disconnect(true);
+    EXPECT_FALSE(scan());
+}
@@ -67,6 +67,10 @@ enum serial_transaction_id {
     PUT_RGB_MATRIX,
 #endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(ENABLE_RGB_MATRIX_DIRECT)
+    PUT_RGB_MATRIX_FRAME,
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(ENABLE_RGB_MATRIX_DIRECT)
+
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
     PUT_WPM,
 #endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
@@ -98,6 +102,10 @@ enum serial_transaction_id {
 #endif // SPLIT_ACTIVITY_ENABLE
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+#    ifdef SPLIT_TRANSACTION_STREAM
+    PUT_STREAM_CHUNK,
+    GET_STREAM_ACK,
+#    endif // SPLIT_TRANSACTION_STREAM
     PUT_RPC_INFO,
     PUT_RPC_REQ_DATA,
     EXECUTE_RPC,
@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "transaction_stats.h"
+#include "timer.h"
+#include "util.h"
+
+// Link quality out of 255, as a moving average of the outcome of the last few transactions
+static uint8_t link_quality = UINT8_MAX;
+
+split_handler_action_t split_handler_schedule_check(const split_handler_schedule_t *schedule) {
+    if (!schedule->waiting || timer_expired32(timer_read32(), schedule->next_attempt)) {
+        return SPLIT_HANDLER_RUN;
+    }
+    return schedule->failures ? SPLIT_HANDLER_DEFERRED : SPLIT_HANDLER_THROTTLED;
+}
+
+void split_handler_schedule_update(split_handler_schedule_t *schedule, bool okay, bool low_priority) {
+    uint32_t delay = 0;
+    if (!okay) {
+        if (schedule->failures < UINT8_MAX) {
+            schedule->failures++;
+        }
+        // Try again in the next scan, then after 1, 2, 4... ms
+        if (schedule->failures > 1) {
+            delay = MIN(1UL << MIN(schedule->failures - 2, 16), SPLIT_TRANSACTION_RETRY_MAX_MS);
+        }
+    } else {
+        schedule->failures = 0;
+        if (low_priority && split_link_degraded()) {
+            delay = SPLIT_LINK_DEGRADED_THROTTLE_MS;
+        }
+    }
+    schedule->waiting      = delay > 0;
+    schedule->next_attempt = timer_read32() + delay;
+}
+
+uint8_t split_link_quality(void) {
+    return link_quality;
+}
+
+bool split_link_degraded(void) {
+    return link_quality < SPLIT_LINK_DEGRADED_THRESHOLD;
+}
+
+void split_link_quality_reset(void) {
+    link_quality = UINT8_MAX;
+}
+
+void split_transaction_record(int8_t id, bool okay, uint32_t start) {
+    // Move an eighth of the way towards 255 or 0, rounding up so that both ends can be reached
+    if (okay) {
+        link_quality += (UINT8_MAX - link_quality + 7) / 8;
+    } else {
+        link_quality -= (link_quality + 7) / 8;
+    }
+
+#ifdef SPLIT_TRANSACTION_STATS
+    split_transaction_stats_record(id, okay, start);
+#endif
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "transaction_stats.h"
+#include "transaction_id_define.h"
+#include "timer.h"
+#include "util.h"
+
+#ifdef SPLIT_TRANSACTION_STATS
+
+#    if defined(PROTOCOL_CHIBIOS)
+#        include <ch.h>
+#        include "chibios_config.h"
+#    endif
+
+#    if defined(PROTOCOL_CHIBIOS) && (PORT_SUPPORTS_RT == TRUE)
+#        define SPLIT_STATS_TIMESTAMP() chSysGetRealtimeCounterX()
+#        define SPLIT_STATS_TICKS_TO_US(ticks) ((ticks) / ((REALTIME_COUNTER_CLOCK) / 1000000UL))
+#    else
+// Millisecond resolution fallback
+#        define SPLIT_STATS_TIMESTAMP() timer_read32()
+#        define SPLIT_STATS_TICKS_TO_US(ticks) ((ticks) * 1000)
+#    endif
+
+static split_transaction_stats_t transaction_stats[NUM_TOTAL_TRANSACTIONS];
+
+uint32_t split_transaction_timestamp(void) {
+    return SPLIT_STATS_TIMESTAMP();
+}
+
+static void saturating_add(uint32_t *counter, uint32_t value) {
+    *counter = *counter > UINT32_MAX - value ? UINT32_MAX : *counter + value;
+}
+
+void split_transaction_stats_record(int8_t id, bool okay, uint32_t start) {
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS) {
+        return;
+    }
+
+    split_transaction_stats_t *stats       = &transaction_stats[id];
+    uint32_t                   duration_us = SPLIT_STATS_TICKS_TO_US(SPLIT_STATS_TIMESTAMP() - start);
+    saturating_add(&stats->count, 1);
+    saturating_add(&stats->errors, okay ? 0 : 1);
+    saturating_add(&stats->total_us, duration_us);
+    stats->last_us = duration_us;
+    stats->max_us  = MAX(stats->max_us, duration_us);
+}
+
+const split_transaction_stats_t *split_transaction_stats_get(int8_t id) {
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS) {
+        return NULL;
+    }
+    return &transaction_stats[id];
+}
+
+void split_transaction_stats_reset(void) {
+    memset(transaction_stats, 0, sizeof(transaction_stats));
+    split_link_quality_reset();
+}
+
+uint8_t split_transaction_stats_read_raw(int8_t id, uint8_t offset, uint8_t *data, uint8_t length) {
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS || offset >= sizeof(split_transaction_stats_t)) {
+        return 0;
+    }
+    uint8_t size = MIN(length, sizeof(split_transaction_stats_t) - offset);
+    memcpy(data, (const uint8_t *)&transaction_stats[id] + offset, size);
+    return size;
+}
+
+#endif // SPLIT_TRANSACTION_STATS
@@ -0,0 +1,120 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * \file
+ *
+ * \brief Error and latency accounting of split transactions on the master
+ * half, and the retry schedule of the transaction handlers built on top of it.
+ * The schedule and link quality are in transaction_schedule.c, the optional
+ * statistics in transaction_stats.c.
+ *
+ * A handler that failed is tried again in a later scan rather than busy
+ * waiting, with a delay that doubles on every failure. While the link quality
+ * is low, low priority handlers only run every SPLIT_LINK_DEGRADED_THROTTLE_MS.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef SPLIT_TRANSACTION_RETRY_MAX_MS
+#    define SPLIT_TRANSACTION_RETRY_MAX_MS 32
+#endif
+
+// Link quality below which the link counts as degraded, out of 255
+#ifndef SPLIT_LINK_DEGRADED_THRESHOLD
+#    define SPLIT_LINK_DEGRADED_THRESHOLD 192
+#endif
+
+#ifndef SPLIT_LINK_DEGRADED_THROTTLE_MS
+#    define SPLIT_LINK_DEGRADED_THROTTLE_MS 500
+#endif
+
+/** \brief Retry schedule of a transaction handler
+ */
+typedef struct {
+    uint8_t  failures;
+    bool     waiting;
+    uint32_t next_attempt;
+} split_handler_schedule_t;
+
+typedef enum {
+    SPLIT_HANDLER_RUN,       // due, run the handler
+    SPLIT_HANDLER_THROTTLED, // low priority handler on a degraded link, skip it for now
+    SPLIT_HANDLER_DEFERRED,  // handler failed and waits to be retried
+} split_handler_action_t;
+
+/** \brief Whether a handler should run in this scan
+ */
+split_handler_action_t split_handler_schedule_check(const split_handler_schedule_t *schedule);
+
+/** \brief Updates the schedule of a handler after it ran
+ */
+void split_handler_schedule_update(split_handler_schedule_t *schedule, bool okay, bool low_priority);
+
+/** \brief Records the outcome of a transaction attempt
+ *
+ * \param start Value of split_transaction_timestamp() before the attempt
+ */
+void split_transaction_record(int8_t id, bool okay, uint32_t start);
+
+/** \brief Quality of the link to the other half, from 0 (all recent
+ * transactions failed) to 255 (none did)
+ */
+uint8_t split_link_quality(void);
+
+/** \brief Whether the link quality is below SPLIT_LINK_DEGRADED_THRESHOLD
+ */
+bool split_link_degraded(void);
+
+/** \brief Sets the link quality back to 255
+ */
+void split_link_quality_reset(void);
+
+#ifdef SPLIT_TRANSACTION_STATS
+
+/** \brief Statistics of a single transaction
+ *
+ * Counters saturate instead of wrapping. Times include retries of the
+ * underlying transport, but not the delay before a handler is tried again.
+ */
+typedef struct {
+    uint32_t count;  // attempts
+    uint32_t errors; // failed attempts
+    uint32_t last_us;
+    uint32_t max_us;
+    uint32_t total_us;
+} split_transaction_stats_t;
+
+/** \brief Timestamp to pass to split_transaction_record()
+ */
+uint32_t split_transaction_timestamp(void);
+
+/** \brief Adds a transaction attempt to the statistics, called by split_transaction_record()
+ */
+void split_transaction_stats_record(int8_t id, bool okay, uint32_t start);
+
+/** \brief Read-only access to the statistics of a transaction
+ */
+const split_transaction_stats_t *split_transaction_stats_get(int8_t id);
+
+/** \brief Clears all recorded statistics
+ */
+void split_transaction_stats_reset(void);
+
+/** \brief Copies up to length bytes of the statistics of a transaction, starting at offset
+ *
+ * Used to transfer statistics over raw HID. Multi-byte values are in the
+ * native (little-endian) byte order of the device.
+ *
+ * \return The number of bytes copied
+ */
+uint8_t split_transaction_stats_read_raw(int8_t id, uint8_t offset, uint8_t *data, uint8_t length);
+
+#else
+
+#    define split_transaction_timestamp() 0
+
+#endif // SPLIT_TRANSACTION_STATS
@@ -0,0 +1,165 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include <stddef.h>
+#include "transaction_stream.h"
+#include "crc.h"
+
+#ifdef SPLIT_TRANSACTION_STREAM
+
+#    define CHUNK_HEADER_SIZE offsetof(split_stream_chunk_t, data)
+
+// Stream being sent by the master
+static struct {
+    const uint8_t        *data;
+    uint16_t              length;
+    uint16_t              chunks;
+    uint16_t              sent;  // next chunk to send
+    uint16_t              acked; // chunks the slave has received in order
+    int8_t                transaction_id;
+    uint8_t               session;
+    uint8_t               stalls;
+    bool                  ack_wanted;
+    split_stream_status_t status;
+} tx;
+
+// Stream being reassembled by the slave
+static struct {
+    int8_t   transaction_id;
+    uint8_t  session;
+    bool     rejected;
+    uint16_t length;
+    uint16_t next;
+    uint8_t  buffer[SPLIT_STREAM_BUFFER_SIZE];
+} rx;
+
+static inline uint16_t stream_chunks(uint16_t length) {
+    // An empty stream still takes a chunk
+    return length ? (length + SPLIT_STREAM_CHUNK_SIZE - 1) / SPLIT_STREAM_CHUNK_SIZE : 1;
+}
+
+static inline uint8_t chunk_size(uint16_t length, uint16_t seq) {
+    return MIN(length - seq * SPLIT_STREAM_CHUNK_SIZE, SPLIT_STREAM_CHUNK_SIZE);
+}
+
+static uint8_t chunk_checksum(const split_stream_chunk_t *chunk) {
+    uint8_t size = chunk->seq < stream_chunks(chunk->length) ? chunk_size(chunk->length, chunk->seq) : 0;
+    return crc8((const uint8_t *)chunk + 1, CHUNK_HEADER_SIZE - 1 + size);
+}
+
+static uint8_t ack_checksum(const split_stream_ack_t *ack) {
+    return crc8((const uint8_t *)ack + 1, sizeof(split_stream_ack_t) - 1);
+}
+
+bool split_stream_start(int8_t transaction_id, const void *data, uint16_t length) {
+    if (tx.status == SPLIT_STREAM_SENDING || length > SPLIT_STREAM_BUFFER_SIZE) {
+        return false;
+    }
+
+    uint8_t session = tx.session + 1;
+    memset(&tx, 0, sizeof(tx));
+    tx.data           = data;
+    tx.length         = length;
+    tx.chunks         = stream_chunks(length);
+    tx.transaction_id = transaction_id;
+    // 0 is what the slave starts out with
+    tx.session = session ? session : 1;
+    tx.status  = SPLIT_STREAM_SENDING;
+    return true;
+}
+
+split_stream_status_t split_stream_status(void) {
+    return tx.status;
+}
+
+bool split_stream_ack_due(void) {
+    return tx.status == SPLIT_STREAM_SENDING && (tx.ack_wanted || tx.sent == tx.chunks || tx.sent - tx.acked >= SPLIT_STREAM_WINDOW);
+}
+
+void split_stream_ack(const split_stream_ack_t *ack) {
+    if (tx.status != SPLIT_STREAM_SENDING) {
+        return;
+    }
+    tx.ack_wanted = false;
+
+    bool valid = ack->checksum == ack_checksum(ack) && ack->session == tx.session;
+    if (valid && (ack->flags & SPLIT_STREAM_ACK_REJECTED)) {
+        tx.status = SPLIT_STREAM_FAILED;
+        return;
+    }
+    if (valid && ack->next > tx.acked && ack->next <= tx.sent) {
+        tx.acked  = ack->next;
+        tx.stalls = 0;
+    } else if (++tx.stalls > SPLIT_STREAM_RETRIES) {
+        tx.status = SPLIT_STREAM_FAILED;
+        return;
+    }
+
+    if (tx.acked == tx.chunks) {
+        tx.status = SPLIT_STREAM_DONE;
+        return;
+    }
+    // Go back to the first chunk the slave is missing, it dropped whatever came after
+    tx.sent = tx.acked;
+}
+
+bool split_stream_next_chunk(split_stream_chunk_t *chunk) {
+    if (tx.status != SPLIT_STREAM_SENDING || split_stream_ack_due()) {
+        return false;
+    }
+
+    uint8_t size          = chunk_size(tx.length, tx.sent);
+    chunk->transaction_id = tx.transaction_id;
+    chunk->session        = tx.session;
+    chunk->length         = tx.length;
+    chunk->seq            = tx.sent;
+    memcpy(chunk->data, &tx.data[tx.sent * SPLIT_STREAM_CHUNK_SIZE], size);
+    chunk->checksum = chunk_checksum(chunk);
+    tx.sent++;
+    return true;
+}
+
+void split_stream_send_failed(void) {
+    if (tx.status != SPLIT_STREAM_SENDING) {
+        return;
+    }
+    tx.ack_wanted = true;
+    if (++tx.stalls > SPLIT_STREAM_RETRIES) {
+        tx.status = SPLIT_STREAM_FAILED;
+    }
+}
+
+void split_stream_receive(const split_stream_chunk_t *chunk, split_stream_callback_t callback, split_stream_ack_t *ack) {
+    if (chunk->checksum != chunk_checksum(chunk)) {
+        return;
+    }
+
+    if (chunk->session != rx.session || chunk->transaction_id != rx.transaction_id) {
+        // Wait for the master to go back to the start of a stream
+        if (chunk->seq != 0) {
+            return;
+        }
+        rx.transaction_id = chunk->transaction_id;
+        rx.session        = chunk->session;
+        rx.length         = chunk->length;
+        rx.next           = 0;
+        rx.rejected       = !callback || chunk->length > SPLIT_STREAM_BUFFER_SIZE;
+    }
+
+    // Anything out of order is sent again after the next acknowledgement
+    if (!rx.rejected && chunk->seq == rx.next && rx.next < stream_chunks(rx.length)) {
+        memcpy(&rx.buffer[rx.next * SPLIT_STREAM_CHUNK_SIZE], chunk->data, chunk_size(rx.length, rx.next));
+        rx.next++;
+        if (rx.next == stream_chunks(rx.length) && callback) {
+            callback(rx.transaction_id, rx.length, rx.buffer);
+        }
+    }
+
+    ack->session  = rx.session;
+    ack->flags    = rx.rejected ? SPLIT_STREAM_ACK_REJECTED : 0;
+    ack->next     = rx.next;
+    ack->checksum = ack_checksum(ack);
+}
+
+#endif // SPLIT_TRANSACTION_STREAM
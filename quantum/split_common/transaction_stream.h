@@ -0,0 +1,120 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * \file
+ *
+ * \brief Transfer of payloads larger than a single transaction from the
+ * master to the slave half.
+ *
+ * The payload is cut into numbered chunks. The master sends up to
+ * SPLIT_STREAM_WINDOW chunks, then reads back how many chunks the slave has
+ * received in order so far. Chunks after the first one missing are sent again,
+ * as the slave drops anything out of order. The slave reassembles the chunks
+ * and hands the whole payload to a callback once complete.
+ *
+ * Only one stream is sent at a time.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "util.h"
+
+// Payload bytes per chunk
+#ifndef SPLIT_STREAM_CHUNK_SIZE
+#    define SPLIT_STREAM_CHUNK_SIZE 32
+#endif
+
+// Chunks sent before waiting for an acknowledgement
+#ifndef SPLIT_STREAM_WINDOW
+#    define SPLIT_STREAM_WINDOW 4
+#endif
+
+// Largest payload, the slave keeps a buffer of this size for reassembly
+#ifndef SPLIT_STREAM_BUFFER_SIZE
+#    define SPLIT_STREAM_BUFFER_SIZE 256
+#endif
+
+// Acknowledgements or transfers in a row without progress before the stream is given up
+#ifndef SPLIT_STREAM_RETRIES
+#    define SPLIT_STREAM_RETRIES 10
+#endif
+
+_Static_assert(SPLIT_STREAM_BUFFER_SIZE <= UINT16_MAX, "SPLIT_STREAM_BUFFER_SIZE out of range");
+
+// Set in an acknowledgement if the slave has no callback for the stream, or it is too long
+#define SPLIT_STREAM_ACK_REJECTED 0x01
+
+typedef struct PACKED {
+    uint8_t  checksum; // crc8 of everything after it, up to the end of the payload of this chunk
+    int8_t   transaction_id;
+    uint8_t  session; // tells consecutive streams apart
+    uint16_t length;  // of the whole stream
+    uint16_t seq;
+    uint8_t  data[SPLIT_STREAM_CHUNK_SIZE];
+} split_stream_chunk_t;
+
+// A chunk is sent as a single transaction, the size of which is a uint8_t
+_Static_assert(SPLIT_STREAM_CHUNK_SIZE > 0 && SPLIT_STREAM_CHUNK_SIZE <= UINT8_MAX - offsetof(split_stream_chunk_t, data), "SPLIT_STREAM_CHUNK_SIZE out of range");
+
+typedef struct PACKED {
+    uint8_t  checksum;
+    uint8_t  session;
+    uint8_t  flags;
+    uint16_t next; // sequence number of the first chunk not received yet
+} split_stream_ack_t;
+
+typedef enum {
+    SPLIT_STREAM_IDLE,
+    SPLIT_STREAM_SENDING,
+    SPLIT_STREAM_DONE,
+    SPLIT_STREAM_FAILED,
+} split_stream_status_t;
+
+/** \brief Slave side handler of a complete stream
+ */
+typedef void (*split_stream_callback_t)(int8_t transaction_id, uint16_t length, const void *data);
+
+/** \brief Starts sending a stream
+ *
+ * The data is read as the chunks are sent, so it has to stay valid until the
+ * stream is no longer SPLIT_STREAM_SENDING.
+ *
+ * \return false if a stream is being sent already, or the data is longer than SPLIT_STREAM_BUFFER_SIZE
+ */
+bool split_stream_start(int8_t transaction_id, const void *data, uint16_t length);
+
+/** \brief Status of the last stream started
+ */
+split_stream_status_t split_stream_status(void);
+
+/** \brief Whether an acknowledgement has to be read before sending on
+ */
+bool split_stream_ack_due(void);
+
+/** \brief Takes in an acknowledgement from the slave
+ */
+void split_stream_ack(const split_stream_ack_t *ack);
+
+/** \brief Prepares the next chunk to send
+ *
+ * \return false if nothing can be sent before the next acknowledgement
+ */
+bool split_stream_next_chunk(split_stream_chunk_t *chunk);
+
+/** \brief Asks for an acknowledgement next, after a chunk or an acknowledgement failed to transfer
+ *
+ * Counts towards SPLIT_STREAM_RETRIES, so that a stream to a slave which went
+ * away eventually fails.
+ */
+void split_stream_send_failed(void);
+
+/** \brief Takes in a chunk on the slave
+ *
+ * \param callback Handler of the stream, NULL if there is none
+ * \param ack Acknowledgement to send back to the master
+ */
+void split_stream_receive(const split_stream_chunk_t *chunk, split_stream_callback_t callback, split_stream_ack_t *ack);
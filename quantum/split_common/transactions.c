@@ -24,12 +24,13 @@
 #include "host.h"
 #include "action_util.h"
 #include "sync_timer.h"
-#include "wait.h"
 #include "transactions.h"
 #include "transport.h"
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#include "transaction_stats.h"
+#include "util.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -84,9 +85,9 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#define transport_write(id, data, length) transport_transaction(id, data, length, NULL, 0)
+#define transport_read(id, data, length) transport_transaction(id, NULL, 0, data, length)
+#define transport_exec(id) transport_transaction(id, NULL, 0, NULL, 0)
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -97,25 +98,71 @@ void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *i
 ////////////////////////////////////////////////////
 // Helpers
 
-static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
-    int num_retries = is_transport_connected() ? 10 : 1;
-    for (int iter = 1; iter <= num_retries; ++iter) {
-        if (iter > 1) {
-            for (int i = 0; i < iter * iter; ++i) {
-                wait_us(10);
-            }
+static bool transport_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    uint32_t start = split_transaction_timestamp();
+    bool     okay  = transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+#ifdef SPLIT_TRANSPORT_BATCH
+    // Batched writes are only queued here, the transport records them once they are exchanged
+    const split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (split_transaction_is_batched(id) && (trans->initiator2target_buffer_size || trans->slave_callback)) {
+        return okay;
+    }
+#endif
+    split_transaction_record(id, okay, start);
+    return okay;
+}
+
+// Whether any handler ran successfully in this scan, and whether any waited to be retried
+static bool handlers_ran;
+static bool handlers_deferred;
+
+static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]), split_handler_schedule_t *schedule, bool low_priority) {
+    // Failed handlers are tried again in a later scan, rather than blocking this one
+    if (schedule) {
+        switch (split_handler_schedule_check(schedule)) {
+            case SPLIT_HANDLER_THROTTLED:
+                return true;
+            case SPLIT_HANDLER_DEFERRED:
+                handlers_deferred = true;
+                return true;
+            default:
+                break;
         }
-        bool this_okay = true;
-        this_okay      = handler(master_matrix, slave_matrix);
-        if (this_okay) return true;
     }
-    dprintf("Failed to execute %s\n", prefix);
-    return false;
+
+    bool okay = handler(master_matrix, slave_matrix);
+    if (schedule) {
+        split_handler_schedule_update(schedule, okay, low_priority);
+    }
+    if (!okay) {
+        dprintf("Failed to execute %s\n", prefix);
+        return false;
+    }
+    handlers_ran = true;
+    return true;
 }
 
-#define TRANSACTION_HANDLER_MASTER(prefix)                                                                              \
-    do {                                                                                                                \
-        if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master)) return false; \
+#define TRANSACTION_HANDLER_MASTER_SCHEDULED(prefix, low_priority)                                                                               \
+    do {                                                                                                                                         \
+        static split_handler_schedule_t schedule;                                                                                                \
+        if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master, &schedule, low_priority)) return false; \
+    } while (0)
+
+#define TRANSACTION_HANDLER_MASTER(prefix) TRANSACTION_HANDLER_MASTER_SCHEDULED(prefix, false)
+
+/**
+ * @brief Constructs a transaction handler that is skipped for a while when
+ * the link is degraded, for features that don't need to be in sync right away.
+ */
+#define TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(prefix) TRANSACTION_HANDLER_MASTER_SCHEDULED(prefix, true)
+
+/**
+ * @brief Constructs a transaction handler that is tried in every scan, even
+ * after failing, as it has to provide output for every scan.
+ */
+#define TRANSACTION_HANDLER_MASTER_EVERY_SCAN(prefix)                                                                                \
+    do {                                                                                                                             \
+        if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master, NULL, false)) return false; \
     } while (0)
 
 /**
@@ -199,7 +246,7 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER_EVERY_SCAN(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
@@ -347,8 +394,11 @@ static bool layer_state_handlers_master(matrix_row_t master_matrix[], matrix_row
 }
 
 static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    layer_state         = split_shmem->layers.layer_state;
-    default_layer_state = split_shmem->layers.default_layer_state;
+    if (layer_state != split_shmem->layers.layer_state || default_layer_state != split_shmem->layers.default_layer_state) {
+        layer_state         = split_shmem->layers.layer_state;
+        default_layer_state = split_shmem->layers.default_layer_state;
+        effective_layer_cache_invalidate();
+    }
 }
 
 // clang-format off
@@ -603,6 +653,95 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
+////////////////////////////////////////////////////
+// RGB Matrix frames
+
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(ENABLE_RGB_MATRIX_DIRECT)
+
+// Shortest time between the start of two frames
+#    ifndef RGB_MATRIX_SPLIT_FRAME_INTERVAL
+#        define RGB_MATRIX_SPLIT_FRAME_INTERVAL 20
+#    endif
+
+// Every LED is sent again at this interval, in case the slave missed a chunk without the master noticing
+#    ifndef RGB_MATRIX_SPLIT_FRAME_FULL_INTERVAL
+#        define RGB_MATRIX_SPLIT_FRAME_FULL_INTERVAL 1000
+#    endif
+
+/**
+ * @brief Sends the direct colours of the LEDs of the slave half which changed,
+ * one chunk per scan until the frame is complete.
+ */
+static bool rgb_matrix_frame_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static rgb_t    sent[RGB_MATRIX_LED_COUNT];
+    static uint32_t last_frame = 0;
+    static uint32_t last_full  = 0;
+    static uint8_t  cursor     = 0;
+    static bool     in_frame   = false;
+    static bool     full       = true;
+
+    if (!rgb_matrix_is_enabled() || rgb_matrix_get_mode() != RGB_MATRIX_DIRECT) {
+        return true;
+    }
+
+    if (!in_frame) {
+        if (timer_elapsed32(last_frame) < RGB_MATRIX_SPLIT_FRAME_INTERVAL) {
+            return true;
+        }
+        last_frame = timer_read32();
+        if (timer_elapsed32(last_full) >= RGB_MATRIX_SPLIT_FRAME_FULL_INTERVAL) {
+            full = true;
+        }
+        if (full) {
+            last_full = last_frame;
+        }
+        cursor   = 0;
+        in_frame = true;
+    }
+
+    const uint8_t           split[2] = RGB_MATRIX_SPLIT;
+    uint8_t                 first    = is_keyboard_left() ? split[0] : 0;
+    uint8_t                 count    = is_keyboard_left() ? split[1] : split[0];
+    rgb_matrix_frame_sync_t frame;
+    frame.length = led_frame_encode(&g_rgb_direct_colors[first], &sent[first], count, &cursor, full, frame.chunk, sizeof(frame.chunk));
+    if (cursor >= count) {
+        in_frame = false;
+        full     = false;
+    }
+
+    // only the part of the chunk which was filled in
+    if (frame.length && !transport_write(PUT_RGB_MATRIX_FRAME, &frame, offsetof(rgb_matrix_frame_sync_t, chunk) + frame.length)) {
+        // The slave may have missed any of the chunks so far, start over with all LEDs
+        in_frame = false;
+        full     = true;
+        return false;
+    }
+    return true;
+}
+
+static void rgb_matrix_frame_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const rgb_matrix_frame_sync_t *frame    = initiator2target_buffer;
+    const uint8_t                  split[2] = RGB_MATRIX_SPLIT;
+    uint8_t                        first    = is_keyboard_left() ? 0 : split[0];
+    uint8_t                        count    = is_keyboard_left() ? split[0] : split[1];
+
+    rgb_matrix_lock();
+    led_frame_decode(frame->chunk, MIN(frame->length, sizeof(frame->chunk)), &g_rgb_direct_colors[first], count);
+    rgb_matrix_unlock();
+}
+
+#    define TRANSACTIONS_RGB_MATRIX_FRAME_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(rgb_matrix_frame)
+#    define TRANSACTIONS_RGB_MATRIX_FRAME_SLAVE()
+#    define TRANSACTIONS_RGB_MATRIX_FRAME_REGISTRATIONS [PUT_RGB_MATRIX_FRAME] = trans_initiator2target_initializer_cb(rgb_matrix_frame_sync, rgb_matrix_frame_slave_callback),
+
+#else // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(ENABLE_RGB_MATRIX_DIRECT)
+
+#    define TRANSACTIONS_RGB_MATRIX_FRAME_MASTER()
+#    define TRANSACTIONS_RGB_MATRIX_FRAME_SLAVE()
+#    define TRANSACTIONS_RGB_MATRIX_FRAME_REGISTRATIONS
+
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(ENABLE_RGB_MATRIX_DIRECT)
+
 ////////////////////////////////////////////////////
 // WPM
 
@@ -618,7 +757,7 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
     set_current_wpm(split_shmem->current_wpm);
 }
 
-#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER(wpm)
+#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(wpm)
 #    define TRANSACTIONS_WPM_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(wpm)
 #    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(current_wpm),
 
@@ -653,7 +792,7 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
     }
 }
 
-#    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER(oled)
+#    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(oled)
 #    define TRANSACTIONS_OLED_SLAVE() TRANSACTION_HANDLER_SLAVE(oled)
 #    define TRANSACTIONS_OLED_REGISTRATIONS [PUT_OLED] = trans_initiator2target_initializer(current_oled_state),
 
@@ -688,7 +827,7 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
     }
 }
 
-#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER(st7565)
+#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(st7565)
 #    define TRANSACTIONS_ST7565_SLAVE() TRANSACTION_HANDLER_SLAVE(st7565)
 #    define TRANSACTIONS_ST7565_REGISTRATIONS [PUT_ST7565] = trans_initiator2target_initializer(current_st7565_state),
 
@@ -844,7 +983,7 @@ static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 }
 
 // clang-format off
-#    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER(haptic)
+#    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(haptic)
 #    define TRANSACTIONS_HAPTIC_SLAVE() TRANSACTION_HANDLER_SLAVE(haptic)
 #    define TRANSACTIONS_HAPTIC_REGISTRATIONS [PUT_HAPTIC] = trans_initiator2target_initializer(haptic_sync),
 // clang-format on
@@ -914,6 +1053,62 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Streams
+
+#ifdef SPLIT_TRANSACTION_STREAM
+
+#    if !defined(SPLIT_TRANSACTION_IDS_KB) && !defined(SPLIT_TRANSACTION_IDS_USER)
+#        error "SPLIT_TRANSACTION_STREAM requires SPLIT_TRANSACTION_IDS_KB or SPLIT_TRANSACTION_IDS_USER"
+#    endif
+
+// Slave side handlers of the keyboard and user transaction ids
+static split_stream_callback_t stream_callbacks[NUM_TOTAL_TRANSACTIONS - GET_RPC_RESP_DATA - 1];
+
+static bool stream_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    if (split_stream_ack_due()) {
+        split_stream_ack_t ack;
+        if (!transport_read(GET_STREAM_ACK, &ack, sizeof(ack))) {
+            split_stream_send_failed();
+            return false;
+        }
+        split_stream_ack(&ack);
+    }
+
+    // Up to a window of chunks per scan
+    split_stream_chunk_t chunk;
+    while (split_stream_next_chunk(&chunk)) {
+        if (!transport_write(PUT_STREAM_CHUNK, &chunk, sizeof(chunk))) {
+            split_stream_send_failed();
+            return false;
+        }
+    }
+    return true;
+}
+
+static void slave_stream_chunk_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_stream_chunk_t *chunk    = initiator2target_buffer;
+    split_stream_callback_t     callback = NULL;
+    if (chunk->transaction_id > GET_RPC_RESP_DATA && chunk->transaction_id < NUM_TOTAL_TRANSACTIONS) {
+        callback = stream_callbacks[chunk->transaction_id - GET_RPC_RESP_DATA - 1];
+    }
+    split_stream_receive(chunk, callback, &split_shmem->stream_ack);
+}
+
+#    define TRANSACTIONS_STREAM_MASTER() TRANSACTION_HANDLER_MASTER_LOW_PRIORITY(stream)
+#    define TRANSACTIONS_STREAM_SLAVE()
+#    define TRANSACTIONS_STREAM_REGISTRATIONS                                                                       \
+        [PUT_STREAM_CHUNK] = trans_initiator2target_initializer_cb(stream_chunk, slave_stream_chunk_callback), \
+        [GET_STREAM_ACK]   = trans_target2initiator_initializer(stream_ack),
+
+#else // SPLIT_TRANSACTION_STREAM
+
+#    define TRANSACTIONS_STREAM_MASTER()
+#    define TRANSACTIONS_STREAM_SLAVE()
+#    define TRANSACTIONS_STREAM_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTION_STREAM
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -936,6 +1131,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_RGBLIGHT_REGISTRATIONS
     TRANSACTIONS_LED_MATRIX_REGISTRATIONS
     TRANSACTIONS_RGB_MATRIX_REGISTRATIONS
+    TRANSACTIONS_RGB_MATRIX_FRAME_REGISTRATIONS
     TRANSACTIONS_WPM_REGISTRATIONS
     TRANSACTIONS_OLED_REGISTRATIONS
     TRANSACTIONS_ST7565_REGISTRATIONS
@@ -944,6 +1140,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_STREAM_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -955,6 +1152,8 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    handlers_ran      = false;
+    handlers_deferred = false;
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -966,6 +1165,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_RGBLIGHT_MASTER();
     TRANSACTIONS_LED_MATRIX_MASTER();
     TRANSACTIONS_RGB_MATRIX_MASTER();
+    TRANSACTIONS_RGB_MATRIX_FRAME_MASTER();
     TRANSACTIONS_WPM_MASTER();
     TRANSACTIONS_OLED_MASTER();
     TRANSACTIONS_ST7565_MASTER();
@@ -974,7 +1174,9 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
-    return true;
+    TRANSACTIONS_STREAM_MASTER();
+    // A scan in which every handler waited to be retried says nothing good about the link
+    return handlers_ran || !handlers_deferred;
 }
 
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -989,6 +1191,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_RGBLIGHT_SLAVE();
     TRANSACTIONS_LED_MATRIX_SLAVE();
     TRANSACTIONS_RGB_MATRIX_SLAVE();
+    TRANSACTIONS_RGB_MATRIX_FRAME_SLAVE();
     TRANSACTIONS_WPM_SLAVE();
     TRANSACTIONS_OLED_SLAVE();
     TRANSACTIONS_ST7565_SLAVE();
@@ -997,6 +1200,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
+    TRANSACTIONS_STREAM_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -1076,4 +1280,31 @@ void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *i
     }
 }
 
+#    ifdef SPLIT_TRANSACTION_STREAM
+
+void transaction_register_stream(int8_t transaction_id, split_stream_callback_t callback) {
+    // Prevent streaming into QMK core sync data
+    if (transaction_id <= GET_RPC_RESP_DATA || transaction_id >= NUM_TOTAL_TRANSACTIONS) return;
+
+    stream_callbacks[transaction_id - GET_RPC_RESP_DATA - 1] = callback;
+}
+
+bool transaction_stream_send(int8_t transaction_id, const void *buffer, uint16_t length) {
+    // Prevent transaction attempts while transport is disconnected
+    if (!is_transport_connected()) {
+        return false;
+    }
+    // Prevent streaming into QMK core sync data
+    if (transaction_id <= GET_RPC_RESP_DATA || transaction_id >= NUM_TOTAL_TRANSACTIONS) return false;
+
+    // The chunks go out with the next scans
+    return split_stream_start(transaction_id, buffer, length);
+}
+
+split_stream_status_t transaction_stream_status(void) {
+    return split_stream_status();
+}
+
+#    endif // SPLIT_TRANSACTION_STREAM
+
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
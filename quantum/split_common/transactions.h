@@ -41,6 +41,64 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 #define split_trans_initiator2target_buffer(trans) (split_shmem_offset_ptr((trans)->initiator2target_offset))
 #define split_trans_target2initiator_buffer(trans) (split_shmem_offset_ptr((trans)->target2initiator_offset))
 
+#ifdef SPLIT_TRANSPORT_BATCH
+// Size of the bitmap of transactions that are sent in a batch frame
+#    define SPLIT_BATCH_DIRTY_SIZE ((NUM_TOTAL_TRANSACTIONS + 7) / 8)
+
+// Whether a transaction is exchanged as part of a batch frame, rather than on its own
+static inline bool split_transaction_is_batched(int8_t id) {
+#    if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    // RPC transactions resize their buffers at runtime
+    if (id >= PUT_RPC_INFO && id <= GET_RPC_RESP_DATA) {
+        return false;
+    }
+#        ifdef SPLIT_TRANSACTION_STREAM
+    // Several chunks go out in one scan
+    if (id == PUT_STREAM_CHUNK) {
+        return false;
+    }
+#        endif
+#    endif
+    // Reads are served from the reply to the previous frame, so they can't depend on data
+    // or callbacks of the same transaction
+    const split_transaction_desc_t *trans = &split_transaction_table[id];
+    return !trans->target2initiator_buffer_size || !(trans->initiator2target_buffer_size || trans->slave_callback);
+}
+#endif // SPLIT_TRANSPORT_BATCH
+
+#ifdef SPLIT_TRANSPORT_PUSH
+// Size of the bitmap of transactions that are sent in a push frame
+#    define SPLIT_PUSH_BITMAP_SIZE ((NUM_TOTAL_TRANSACTIONS + 7) / 8)
+
+// Interval of the slave sending all of its pushed state, even if nothing changed
+#    ifndef SPLIT_TRANSPORT_PUSH_HEARTBEAT
+#        define SPLIT_TRANSPORT_PUSH_HEARTBEAT 100
+#    endif
+// Time after the last push frame that the master goes back to polling the slave
+#    ifndef SPLIT_TRANSPORT_PUSH_TIMEOUT
+#        define SPLIT_TRANSPORT_PUSH_TIMEOUT (3 * (SPLIT_TRANSPORT_PUSH_HEARTBEAT))
+#    endif
+
+// Whether the slave pushes the data of a transaction by itself, rather than the master polling it
+static inline bool split_transaction_is_pushed(int8_t id) {
+    switch (id) {
+        case GET_SLAVE_MATRIX_CHECKSUM:
+        case GET_SLAVE_MATRIX_DATA:
+#    ifdef ENCODER_ENABLE
+        case GET_ENCODERS_CHECKSUM:
+        case GET_ENCODERS_DATA:
+#    endif
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+        case GET_POINTING_CHECKSUM:
+        case GET_POINTING_DATA:
+#    endif
+            return true;
+        default:
+            return false;
+    }
+}
+#endif // SPLIT_TRANSPORT_PUSH
+
 // returns false if valid data not received from slave
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
@@ -51,3 +109,13 @@ bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer
 
 #define transaction_rpc_send(transaction_id, initiator2target_buffer_size, initiator2target_buffer) transaction_rpc_exec(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, NULL)
 #define transaction_rpc_recv(transaction_id, target2initiator_buffer_size, target2initiator_buffer) transaction_rpc_exec(transaction_id, 0, NULL, target2initiator_buffer_size, target2initiator_buffer)
+
+#ifdef SPLIT_TRANSACTION_STREAM
+#    include "transaction_stream.h"
+
+void transaction_register_stream(int8_t transaction_id, split_stream_callback_t callback);
+
+bool transaction_stream_send(int8_t transaction_id, const void *buffer, uint16_t length);
+
+split_stream_status_t transaction_stream_status(void);
+#endif // SPLIT_TRANSACTION_STREAM
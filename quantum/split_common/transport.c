@@ -20,10 +20,19 @@
 #include "transactions.h"
 #include "transport.h"
 #include "transaction_id_define.h"
+#include "transaction_stats.h"
 #include "atomic_util.h"
+#include "timer.h"
 
 #ifdef USE_I2C
 
+#    ifdef SPLIT_TRANSPORT_BATCH
+#        error "SPLIT_TRANSPORT_BATCH is only supported by serial transports"
+#    endif
+#    ifdef SPLIT_TRANSPORT_PUSH
+#        error "SPLIT_TRANSPORT_PUSH is only supported by serial transports"
+#    endif
+
 #    ifndef SLAVE_I2C_TIMEOUT
 #        define SLAVE_I2C_TIMEOUT 100
 #    endif // SLAVE_I2C_TIMEOUT
@@ -90,9 +99,51 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 
 #    include "serial.h"
 
+#    if defined(SPLIT_TRANSPORT_BATCH) && defined(SERIAL_DRIVER_BITBANG)
+#        error "SPLIT_TRANSPORT_BATCH requires SERIAL_DRIVER = usart or vendor"
+#    endif
+#    if defined(SPLIT_TRANSPORT_PUSH) && !defined(SERIAL_DRIVER_USART)
+#        error "SPLIT_TRANSPORT_PUSH requires SERIAL_DRIVER = usart"
+#    endif
+#    if defined(SPLIT_TRANSPORT_PUSH) && defined(SPLIT_TRANSPORT_BATCH)
+#        error "SPLIT_TRANSPORT_PUSH and SPLIT_TRANSPORT_BATCH can't be used together"
+#    endif
+
 static split_shared_memory_t shared_memory;
 split_shared_memory_t *const split_shmem = &shared_memory;
 
+#    ifdef SPLIT_TRANSPORT_BATCH
+// Batched transactions with data or a slave callback, waiting for the next exchange
+static uint8_t batch_dirty[SPLIT_BATCH_DIRTY_SIZE];
+// Whether the shared memory holds the reply of a successful exchange
+static bool batch_okay;
+
+static bool batch_pending(void) {
+    for (uint8_t i = 0; i < SPLIT_BATCH_DIRTY_SIZE; i++) {
+        if (batch_dirty[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool batch_exchange(void) {
+    uint32_t start = split_transaction_timestamp();
+    batch_okay     = soft_serial_batch_transaction(batch_dirty);
+    // The queued writes are only sent now, so this is where their outcome is known
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (batch_dirty[id / 8] & (1 << (id % 8))) {
+            split_transaction_record(id, batch_okay, start);
+        }
+    }
+    // Keep everything queued after a failure, to be sent with the next exchange
+    if (batch_okay) {
+        memset(batch_dirty, 0, sizeof(batch_dirty));
+    }
+    return batch_okay;
+}
+#    endif // SPLIT_TRANSPORT_BATCH
+
 void transport_master_init(void) {
     soft_serial_initiator_init();
 }
@@ -107,9 +158,28 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
         memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
     }
 
+#    ifdef SPLIT_TRANSPORT_BATCH
+    if (split_transaction_is_batched(id)) {
+        // Writes go out with the next exchange, reads come from the last one
+        if (trans->initiator2target_buffer_size || trans->slave_callback) {
+            batch_dirty[id / 8] |= 1 << (id % 8);
+        }
+        if (target2initiator_length > 0 && !batch_okay) {
+            return false;
+        }
+    } else if (!soft_serial_transaction(id)) {
+        return false;
+    }
+#    elif defined(SPLIT_TRANSPORT_PUSH)
+    // Reads of pushed data don't need a round trip, unless the push frames can't be trusted
+    if (!(split_transaction_is_pushed(id) && soft_serial_push_read(id)) && !soft_serial_transaction(id)) {
+        return false;
+    }
+#    else
     if (!soft_serial_transaction(id)) {
         return false;
     }
+#    endif
 
     if (target2initiator_length > 0) {
         size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
@@ -122,9 +192,33 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #endif // USE_I2C
 
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_TRANSPORT_BATCH
+    // One exchange fetches the slave state for this scan, along with anything left over from a
+    // failed one. Whatever the handlers queue is flushed right after, so that it isn't held back a
+    // scan. A half that didn't answer isn't tried twice.
+    bool okay = batch_exchange();
+    okay &= transactions_master(master_matrix, slave_matrix);
+    if (batch_okay && batch_pending()) {
+        okay &= batch_exchange();
+    }
+    return okay;
+#elif defined(SPLIT_TRANSPORT_PUSH)
+    // Take in whatever the slave pushed since the last scan, before the handlers read it
+    soft_serial_push_poll();
+    return transactions_master(master_matrix, slave_matrix);
+#else
     return transactions_master(master_matrix, slave_matrix);
+#endif
 }
 
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     transactions_slave(master_matrix, slave_matrix);
+#ifdef SPLIT_TRANSPORT_PUSH
+    // Push what changed in this scan right away, and everything now and then so the master knows the link is up
+    static uint32_t last_heartbeat = 0;
+    bool            heartbeat      = timer_elapsed32(last_heartbeat) >= SPLIT_TRANSPORT_PUSH_HEARTBEAT;
+    if (soft_serial_push(heartbeat) && heartbeat) {
+        last_heartbeat = timer_read32();
+    }
+#endif
 }
@@ -95,6 +95,22 @@ typedef struct _rgb_matrix_sync_t {
 } rgb_matrix_sync_t;
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(ENABLE_RGB_MATRIX_DIRECT)
+#    include "led_frame.h"
+
+// Bytes of encoded LED colours per transaction, the length byte has to fit as well
+#    ifndef RGB_MATRIX_SPLIT_FRAME_SIZE
+#        define RGB_MATRIX_SPLIT_FRAME_SIZE 32
+#    endif
+
+_Static_assert(RGB_MATRIX_SPLIT_FRAME_SIZE >= LED_FRAME_CHUNK_MIN && RGB_MATRIX_SPLIT_FRAME_SIZE < UINT8_MAX, "RGB_MATRIX_SPLIT_FRAME_SIZE out of range");
+
+typedef struct _rgb_matrix_frame_sync_t {
+    uint8_t length;
+    uint8_t chunk[RGB_MATRIX_SPLIT_FRAME_SIZE];
+} rgb_matrix_frame_sync_t;
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(ENABLE_RGB_MATRIX_DIRECT)
+
 #ifdef SPLIT_MODS_ENABLE
 typedef struct _split_mods_sync_t {
     uint8_t real_mods;
@@ -141,6 +157,10 @@ typedef struct _rpc_sync_info_t {
         uint8_t s2m_length;
     } payload;
 } rpc_sync_info_t;
+
+#    ifdef SPLIT_TRANSACTION_STREAM
+#        include "transaction_stream.h"
+#    endif // SPLIT_TRANSACTION_STREAM
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
@@ -194,6 +214,10 @@ typedef struct _split_shared_memory_t {
     rgb_matrix_sync_t rgb_matrix_sync;
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(ENABLE_RGB_MATRIX_DIRECT)
+    rgb_matrix_frame_sync_t rgb_matrix_frame_sync;
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(ENABLE_RGB_MATRIX_DIRECT)
+
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
     uint8_t current_wpm;
 #endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
@@ -226,6 +250,10 @@ typedef struct _split_shared_memory_t {
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
     uint8_t         rpc_s2m_buffer[RPC_S2M_BUFFER_SIZE];
+#    ifdef SPLIT_TRANSACTION_STREAM
+    split_stream_chunk_t stream_chunk;
+    split_stream_ack_t   stream_ack;
+#    endif // SPLIT_TRANSACTION_STREAM
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
@@ -0,0 +1,172 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "tracepoint.h"
+#include "atomic_util.h"
+#include "timer.h"
+#include "util.h"
+#include "print.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    include "chibios_config.h"
+#endif
+
+#if defined(PROTOCOL_CHIBIOS) && (PORT_SUPPORTS_RT == TRUE)
+#    define TRACEPOINT_TIMESTAMP() chSysGetRealtimeCounterX()
+#    define TRACEPOINT_CLOCK_HZ (REALTIME_COUNTER_CLOCK)
+#else
+// Millisecond resolution fallback
+#    define TRACEPOINT_TIMESTAMP() timer_read32()
+#    define TRACEPOINT_CLOCK_HZ 1000
+#endif
+
+#ifndef TRACEPOINT_INFO_INTERVAL
+#    define TRACEPOINT_INFO_INTERVAL 5000
+#endif
+
+// Draining starts once this many events are pending, or once TRACEPOINT_DRAIN_INTERVAL has passed
+#ifndef TRACEPOINT_DRAIN_THRESHOLD
+#    define TRACEPOINT_DRAIN_THRESHOLD (TRACEPOINT_BUFFER_SIZE / 2)
+#endif
+
+#ifndef TRACEPOINT_DRAIN_INTERVAL
+#    define TRACEPOINT_DRAIN_INTERVAL 100
+#endif
+
+// Events printed per line, at most one line is printed per call of tracepoint_task()
+#ifndef TRACEPOINT_DRAIN_BATCH
+#    define TRACEPOINT_DRAIN_BATCH 16
+#endif
+
+_Static_assert(TRACEPOINT_COUNT <= 256, "Too many tracepoints registered");
+_Static_assert((TRACEPOINT_BUFFER_SIZE & (TRACEPOINT_BUFFER_SIZE - 1)) == 0, "TRACEPOINT_BUFFER_SIZE must be a power of two");
+_Static_assert(sizeof(tracepoint_record_t) * TRACEPOINT_DRAIN_BATCH <= UINT8_MAX, "TRACEPOINT_DRAIN_BATCH too large");
+
+#define TRACEPOINT_NAME(name) #name,
+static const char *const tracepoint_names[] = {TRACEPOINTS_QUANTUM(TRACEPOINT_NAME) TRACEPOINTS_USER(TRACEPOINT_NAME)};
+#undef TRACEPOINT_NAME
+
+static tracepoint_record_t tracepoint_buffer[TRACEPOINT_BUFFER_SIZE];
+static volatile uint16_t   tracepoint_head          = 0;
+static volatile uint16_t   tracepoint_tail          = 0;
+static volatile uint32_t   tracepoint_dropped_count = 0;
+
+void tracepoint_record(tracepoint_id_t id, tracepoint_type_t type) {
+    // Timestamp outside of the critical section, so it reflects the call site
+    uint32_t timestamp = TRACEPOINT_TIMESTAMP();
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        uint16_t next = (tracepoint_head + 1) & (TRACEPOINT_BUFFER_SIZE - 1);
+        if (next == tracepoint_tail) {
+            tracepoint_dropped_count++;
+        } else {
+            tracepoint_buffer[tracepoint_head] = (tracepoint_record_t){.timestamp = timestamp, .id = id, .type = type};
+            tracepoint_head                    = next;
+        }
+    }
+}
+
+uint8_t tracepoint_read(uint8_t *data, uint8_t length) {
+    uint8_t size = 0;
+    while (size + sizeof(tracepoint_record_t) <= length) {
+        bool got_record = false;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            if (tracepoint_tail != tracepoint_head) {
+                memcpy(&data[size], &tracepoint_buffer[tracepoint_tail], sizeof(tracepoint_record_t));
+                tracepoint_tail = (tracepoint_tail + 1) & (TRACEPOINT_BUFFER_SIZE - 1);
+                got_record      = true;
+            }
+        }
+        if (!got_record) {
+            break;
+        }
+        size += sizeof(tracepoint_record_t);
+    }
+    return size;
+}
+
+uint16_t tracepoint_pending(void) {
+    uint16_t pending;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        pending = (tracepoint_head - tracepoint_tail) & (TRACEPOINT_BUFFER_SIZE - 1);
+    }
+    return pending;
+}
+
+uint32_t tracepoint_dropped(void) {
+    return tracepoint_dropped_count;
+}
+
+uint32_t tracepoint_clock_hz(void) {
+    return TRACEPOINT_CLOCK_HZ;
+}
+
+void tracepoint_clear(void) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        tracepoint_head          = 0;
+        tracepoint_tail          = 0;
+        tracepoint_dropped_count = 0;
+    }
+}
+
+const char *tracepoint_name(tracepoint_id_t id) {
+    if (id >= TRACEPOINT_COUNT) {
+        return NULL;
+    }
+    return tracepoint_names[id];
+}
+
+#if defined(CONSOLE_ENABLE) && !defined(TRACEPOINT_MANUAL_DRAIN)
+static void tracepoint_print_info(void) {
+    uprintf("TP-INFO:%lu", (unsigned long)TRACEPOINT_CLOCK_HZ);
+    for (uint8_t i = 0; i < TRACEPOINT_COUNT; i++) {
+        uprintf("%c%s", i ? ',' : ':', tracepoint_names[i]);
+    }
+    uprintf("\n");
+}
+#endif
+
+void tracepoint_task(void) {
+#if defined(CONSOLE_ENABLE) && !defined(TRACEPOINT_MANUAL_DRAIN)
+    // The console may be attached at any time, so repeat the clock/name table periodically
+    static uint32_t last_info = 0;
+    static bool     info_sent = false;
+    if (!info_sent || timer_elapsed32(last_info) >= TRACEPOINT_INFO_INTERVAL) {
+        tracepoint_print_info();
+        last_info = timer_read32();
+        info_sent = true;
+    }
+
+    // Don't print a line for every few events, the console would be busy every scan
+    static uint32_t last_drain = 0;
+    static bool     draining   = false;
+    uint16_t        pending    = tracepoint_pending();
+    if (!draining && pending && (pending >= TRACEPOINT_DRAIN_THRESHOLD || timer_elapsed32(last_drain) >= TRACEPOINT_DRAIN_INTERVAL)) {
+        draining = true;
+    }
+    if (!draining) {
+        return;
+    }
+
+    // One line of hex encoded records, 6 bytes each
+    uint8_t data[sizeof(tracepoint_record_t) * TRACEPOINT_DRAIN_BATCH];
+    uint8_t size = tracepoint_read(data, sizeof(data));
+    uprintf("TP:");
+    for (uint8_t i = 0; i < size; i++) {
+        uprintf("%02X", data[i]);
+    }
+    uprintf("\n");
+    if (size < sizeof(data) || !tracepoint_pending()) {
+        draining   = false;
+        last_drain = timer_read32();
+    }
+
+    static uint32_t last_dropped = 0;
+    uint32_t        dropped      = tracepoint_dropped();
+    if (dropped != last_dropped) {
+        uprintf("TP-DROP:%lu\n", (unsigned long)dropped);
+        last_dropped = dropped;
+    }
+#endif
+}
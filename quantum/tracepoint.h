@@ -0,0 +1,113 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    This API records timestamped begin/end events into a ring buffer, which is
+    drained over console (or manually, e.g. over raw HID) and can be converted
+    to a Chrome trace / Perfetto JSON file with `qmk trace2json`.
+
+    Tracepoints are registered at compile time. Additional ones can be added
+    from config.h:
+
+        #define TRACEPOINTS_USER(X) X(my_task) X(my_other_task)
+
+    Usage example:
+
+        #include "tracepoint.h"
+
+        // Original code:
+        my_task();
+
+        // Delete the original, replace with the following (variant 1, explicit begin/end):
+        TRACE_BEGIN(my_task);
+        my_task();
+        TRACE_END(my_task);
+
+        // Delete the original, replace with the following (variant 2, scoped):
+        TRACE_SCOPE(my_task, {
+            my_task();
+        });
+
+    When TRACEPOINT_ENABLE is not set all of the above compile to nothing.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// clang-format off
+#define TRACEPOINTS_QUANTUM(X) \
+    X(keyboard_task)           \
+    X(matrix_task)             \
+    X(housekeeping_task)
+// clang-format on
+
+#ifndef TRACEPOINTS_USER
+#    define TRACEPOINTS_USER(X)
+#endif
+
+#define TRACEPOINT_ID(name) TRACEPOINT_##name,
+typedef enum {
+    TRACEPOINTS_QUANTUM(TRACEPOINT_ID) TRACEPOINTS_USER(TRACEPOINT_ID) TRACEPOINT_COUNT,
+} tracepoint_id_t;
+#undef TRACEPOINT_ID
+
+typedef enum {
+    TRACEPOINT_BEGIN   = 'B',
+    TRACEPOINT_END     = 'E',
+    TRACEPOINT_INSTANT = 'i',
+} tracepoint_type_t;
+
+/* Wire format of a single event, as drained over console/raw HID. */
+typedef struct __attribute__((packed)) {
+    uint32_t timestamp; // in ticks of tracepoint_clock_hz(), little-endian
+    uint8_t  id;        // tracepoint_id_t
+    uint8_t  type;      // tracepoint_type_t
+} tracepoint_record_t;
+
+#ifdef TRACEPOINT_ENABLE
+
+#    ifndef TRACEPOINT_BUFFER_SIZE
+#        define TRACEPOINT_BUFFER_SIZE 128
+#    endif
+
+void     tracepoint_record(tracepoint_id_t id, tracepoint_type_t type);
+uint8_t  tracepoint_read(uint8_t *data, uint8_t length);
+uint16_t tracepoint_pending(void);
+uint32_t tracepoint_dropped(void);
+uint32_t tracepoint_clock_hz(void);
+void     tracepoint_clear(void);
+
+const char *tracepoint_name(tracepoint_id_t id);
+
+void tracepoint_task(void);
+
+#    define TRACE_BEGIN(name) tracepoint_record(TRACEPOINT_##name, TRACEPOINT_BEGIN)
+#    define TRACE_END(name) tracepoint_record(TRACEPOINT_##name, TRACEPOINT_END)
+#    define TRACE_INSTANT(name) tracepoint_record(TRACEPOINT_##name, TRACEPOINT_INSTANT)
+#    define TRACE_SCOPE(name, call) \
+        do {                        \
+            TRACE_BEGIN(name);      \
+            do {                    \
+                call;               \
+            } while (0);            \
+            TRACE_END(name);        \
+        } while (0)
+
+#else
+
+#    define TRACE_BEGIN(name) \
+        do {                  \
+        } while (0)
+#    define TRACE_END(name) \
+        do {                \
+        } while (0)
+#    define TRACE_INSTANT(name) \
+        do {                    \
+        } while (0)
+#    define TRACE_SCOPE(name, call) \
+        do {                        \
+            call;                   \
+        } while (0)
+
+#endif // TRACEPOINT_ENABLE
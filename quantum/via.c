@@ -57,6 +57,14 @@
 #    include "led_matrix.h"
 #endif
 
+#if defined(PERF_STATS_ENABLE)
+#    include "perf_stats.h"
+#endif
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSACTION_STATS)
+#    include "transaction_stats.h"
+#endif
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void) {
@@ -216,11 +224,14 @@ __attribute__((weak)) void via_custom_value_command_kb(uint8_t *data, uint8_t le
 // This is the default handler for custom value commands.
 // It routes commands with channel IDs to command handlers as such:
 //
-//      id_qmk_backlight_channel    ->  via_qmk_backlight_command()
-//      id_qmk_rgblight_channel     ->  via_qmk_rgblight_command()
-//      id_qmk_rgb_matrix_channel   ->  via_qmk_rgb_matrix_command()
-//      id_qmk_led_matrix_channel   ->  via_qmk_led_matrix_command()
-//      id_qmk_audio_channel        ->  via_qmk_audio_command()
+//      id_qmk_backlight_channel          ->  via_qmk_backlight_command()
+//      id_qmk_rgblight_channel           ->  via_qmk_rgblight_command()
+//      id_qmk_rgb_matrix_channel         ->  via_qmk_rgb_matrix_command()
+//      id_qmk_led_matrix_channel         ->  via_qmk_led_matrix_command()
+//      id_qmk_audio_channel              ->  via_qmk_audio_command()
+//      id_qmk_perf_stats_channel         ->  via_qmk_perf_stats_command()
+//      id_qmk_split_stats_channel        ->  via_qmk_split_stats_command()
+//      id_qmk_rgb_matrix_direct_channel  ->  via_qmk_rgb_matrix_direct_command()
 //
 __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t length) {
     // data = [ command_id, channel_id, value_id, value_data ]
@@ -245,6 +256,12 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
         via_qmk_rgb_matrix_command(data, length);
         return;
     }
+#    if defined(ENABLE_RGB_MATRIX_DIRECT)
+    if (*channel_id == id_qmk_rgb_matrix_direct_channel) {
+        via_qmk_rgb_matrix_direct_command(data, length);
+        return;
+    }
+#    endif
 #endif // RGB_MATRIX_ENABLE
 
 #if defined(LED_MATRIX_ENABLE)
@@ -261,6 +278,20 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
     }
 #endif // AUDIO_ENABLE
 
+#if defined(PERF_STATS_ENABLE)
+    if (*channel_id == id_qmk_perf_stats_channel) {
+        via_qmk_perf_stats_command(data, length);
+        return;
+    }
+#endif // PERF_STATS_ENABLE
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSACTION_STATS)
+    if (*channel_id == id_qmk_split_stats_channel) {
+        via_qmk_split_stats_command(data, length);
+        return;
+    }
+#endif
+
     (void)channel_id; // force use of variable
 
     // If we haven't returned before here, then let the keyboard level code
@@ -718,6 +749,28 @@ void via_qmk_rgb_matrix_save(void) {
     eeconfig_update_rgb_matrix();
 }
 
+#    if defined(ENABLE_RGB_MATRIX_DIRECT)
+void via_qmk_rgb_matrix_direct_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id = &(data[0]);
+    uint8_t *value_id   = &(data[2]);
+    uint8_t *value_data = &(data[3]);
+
+    if (*command_id != id_custom_set_value || *value_id != id_qmk_rgb_matrix_direct_color) {
+        *command_id = id_unhandled;
+        return;
+    }
+
+    // value_data = [ first_led, led_count, r, g, b, r, g, b, ... ]
+    uint8_t max_count = (length - 5) / 3;
+    uint8_t count     = value_data[1] < max_count ? value_data[1] : max_count;
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t *rgb = &value_data[2 + i * 3];
+        rgb_matrix_direct_set_color(value_data[0] + i, rgb[0], rgb[1], rgb[2]);
+    }
+}
+#    endif // ENABLE_RGB_MATRIX_DIRECT
+
 #endif // RGB_MATRIX_ENABLE
 
 #if defined(LED_MATRIX_ENABLE)
@@ -865,3 +918,76 @@ void via_qmk_audio_save(void) {
 }
 
 #endif // QMK_AUDIO_ENABLE
+
+#if defined(PERF_STATS_ENABLE)
+
+void via_qmk_perf_stats_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id = &(data[0]);
+    uint8_t *value_id   = &(data[2]);
+    uint8_t *value_data = &(data[3]);
+
+    if (*value_id != id_qmk_perf_stats_task) {
+        *command_id = id_unhandled;
+        return;
+    }
+
+    switch (*command_id) {
+        case id_custom_set_value: {
+            perf_stats_reset();
+            break;
+        }
+        case id_custom_get_value: {
+            // value_data = [ task id, byte offset into perf_stats_t, raw bytes ]
+            perf_stats_read_raw(value_data[0], value_data[1], &value_data[2], length - 5);
+            break;
+        }
+        case id_custom_save: {
+            // nothing is stored
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+#endif // PERF_STATS_ENABLE
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSACTION_STATS)
+
+void via_qmk_split_stats_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id = &(data[0]);
+    uint8_t *value_id   = &(data[2]);
+    uint8_t *value_data = &(data[3]);
+
+    if (*value_id != id_qmk_split_stats_transaction) {
+        *command_id = id_unhandled;
+        return;
+    }
+
+    switch (*command_id) {
+        case id_custom_set_value: {
+            split_transaction_stats_reset();
+            break;
+        }
+        case id_custom_get_value: {
+            // value_data = [ transaction id, byte offset into split_transaction_stats_t, link quality, raw bytes ]
+            value_data[2] = split_link_quality();
+            split_transaction_stats_read_raw(value_data[0], value_data[1], &value_data[3], length - 6);
+            break;
+        }
+        case id_custom_save: {
+            // nothing is stored
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+#endif
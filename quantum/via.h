@@ -111,6 +111,12 @@ enum via_channel_id {
     id_qmk_rgb_matrix_channel = 3,
     id_qmk_audio_channel      = 4,
     id_qmk_led_matrix_channel = 5,
+
+    // QMK extensions, not part of the VIA protocol, so VIA Configurator does not use them.
+    // They are numbered from 0x80 to stay clear of the channels VIA defines.
+    id_qmk_perf_stats_channel        = 0x80,
+    id_qmk_split_stats_channel       = 0x81,
+    id_qmk_rgb_matrix_direct_channel = 0x82,
 };
 
 enum via_qmk_backlight_value {
@@ -143,6 +149,18 @@ enum via_qmk_audio_value {
     id_qmk_audio_clicky_enable = 2,
 };
 
+enum via_qmk_perf_stats_value {
+    id_qmk_perf_stats_task = 1,
+};
+
+enum via_qmk_split_stats_value {
+    id_qmk_split_stats_transaction = 1,
+};
+
+enum via_qmk_rgb_matrix_direct_value {
+    id_qmk_rgb_matrix_direct_color = 1,
+};
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void);
@@ -188,6 +206,9 @@ void via_qmk_rgb_matrix_command(uint8_t *data, uint8_t length);
 void via_qmk_rgb_matrix_set_value(uint8_t *data);
 void via_qmk_rgb_matrix_get_value(uint8_t *data);
 void via_qmk_rgb_matrix_save(void);
+#    if defined(ENABLE_RGB_MATRIX_DIRECT)
+void via_qmk_rgb_matrix_direct_command(uint8_t *data, uint8_t length);
+#    endif
 #endif
 
 #if defined(LED_MATRIX_ENABLE)
@@ -202,4 +223,12 @@ void via_qmk_audio_command(uint8_t *data, uint8_t length);
 void via_qmk_audio_set_value(uint8_t *data);
 void via_qmk_audio_get_value(uint8_t *data);
 void via_qmk_audio_save(void);
+#endif
+
+#if defined(PERF_STATS_ENABLE)
+void via_qmk_perf_stats_command(uint8_t *data, uint8_t length);
+#endif
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSACTION_STATS)
+void via_qmk_split_stats_command(uint8_t *data, uint8_t length);
 #endif
\ No newline at end of file
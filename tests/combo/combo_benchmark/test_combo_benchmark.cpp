@@ -0,0 +1,66 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Cost of process_combo() with the 500 combos of combo_large_table, built
+ * with and without COMBO_KEYCODE_INDEX. Compare the two with:
+ *
+ *     make bench:combo/combo_benchmark bench:combo/combo_keycode_index_benchmark
+ */
+
+#include <chrono>
+#include "keyboard_report_util.hpp"
+#include "quantum.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+
+void large_table_combos_init(void);
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+class ComboBenchmark : public TestFixture {
+   protected:
+    void SetUp() override {
+        large_table_combos_init();
+    }
+
+    static keyrecord_t make_record(uint16_t keycode, bool pressed) {
+        keyrecord_t record   = {};
+        record.event.type    = KEY_EVENT;
+        record.event.pressed = pressed;
+        record.event.time    = timer_read();
+        record.keycode       = keycode;
+        return record;
+    }
+};
+
+TEST_F(ComboBenchmark, ProcessComboCost) {
+    constexpr int iterations = 20000;
+    TestDriver    driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    // Taps of the 50 keycodes used by the combos, and 10 which aren't part of any
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        uint16_t    keycode = KC_A + i % 60;
+        keyrecord_t press   = make_record(keycode, true);
+        keyrecord_t release = make_record(keycode, false);
+        process_combo(keycode, &press);
+        process_combo(keycode, &release);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    clear_keyboard();
+    VERIFY_AND_CLEAR(driver);
+
+#ifdef COMBO_KEYCODE_INDEX
+    const char *mode = "keycode index";
+#else
+    const char *mode = "linear scan";
+#endif
+    fprintf(stdout, "combo benchmark: %d combos, %s: %.1f ns/event\n", combo_count(), mode, std::chrono::duration<double, std::nano>(elapsed).count() / (iterations * 2));
+}
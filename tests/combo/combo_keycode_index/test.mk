@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+COMBO_ENABLE = yes
+
+# The same combos and tests as combo_large_table, with the keycode index enabled
+INTROSPECTION_KEYMAP_C = ../combo_large_table/test_combos_large_table.c
+SRC += tests/combo/combo_large_table/test_combo_large_table.cpp
@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+COMBO_ENABLE = yes
+
+# The same benchmark as combo_benchmark, with the keycode index enabled
+INTROSPECTION_KEYMAP_C = ../combo_large_table/test_combos_large_table.c
+SRC += tests/combo/combo_benchmark/test_combo_benchmark.cpp
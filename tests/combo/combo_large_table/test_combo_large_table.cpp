@@ -0,0 +1,77 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * 500 combos, built with and without COMBO_KEYCODE_INDEX, so that both
+ * find the same combos in a large combo table.
+ */
+
+#include "keyboard_report_util.hpp"
+#include "quantum.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+
+void large_table_combos_init(void);
+}
+
+using testing::_;
+using testing::InSequence;
+
+class ComboLargeTable : public TestFixture {
+   protected:
+    void SetUp() override {
+        large_table_combos_init();
+    }
+};
+
+TEST_F(ComboLargeTable, TwoKeyComboIsTapped) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_F1));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLargeTable, LongestOverlappingComboIsTapped) {
+    TestDriver driver;
+    KeymapKey  key_b(0, 0, 0, KC_B);
+    KeymapKey  key_c(0, 1, 0, KC_C);
+    KeymapKey  key_m(0, 2, 0, KC_M);
+    set_keymap({key_b, key_c, key_m});
+
+    // Combo 1 is B + C + M, combo 452 is only C + M
+    EXPECT_REPORT(driver, (KC_F2));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_b, key_c, key_m});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLargeTable, ComboKeyOnItsOwnIsSent) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLargeTable, KeyOutsideOfCombosIsSent) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_right(0, 0, 0, KC_RIGHT);
+    set_keymap({key_right});
+
+    EXPECT_REPORT(driver, (KC_RIGHT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_right);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+#define LARGE_TABLE_COMBO_COUNT 500
+#define LARGE_TABLE_COMBO_KEYCODES 50
+
+/* Combo n is made of the keycodes n % 50 and n % 50 + 1 + n / 50 (counting
+ * from KC_A), odd combos have a third keycode 10 further on. Every keycode
+ * from KC_A to KC_GRAVE is part of 20 to 30 combos. */
+static uint16_t large_table_combo_keys[LARGE_TABLE_COMBO_COUNT][4];
+combo_t         key_combos[LARGE_TABLE_COMBO_COUNT];
+
+void large_table_combos_init(void) {
+    for (uint16_t i = 0; i < LARGE_TABLE_COMBO_COUNT; i++) {
+        uint16_t *keys   = large_table_combo_keys[i];
+        uint8_t   first  = i % LARGE_TABLE_COMBO_KEYCODES;
+        uint8_t   offset = 1 + i / LARGE_TABLE_COMBO_KEYCODES;
+
+        keys[0] = KC_A + first;
+        keys[1] = KC_A + (first + offset) % LARGE_TABLE_COMBO_KEYCODES;
+        keys[2] = (i & 1) ? KC_A + (first + offset + 10) % LARGE_TABLE_COMBO_KEYCODES : COMBO_END;
+        keys[3] = COMBO_END;
+
+        key_combos[i] = (combo_t)COMBO(keys, KC_F1 + i % 12);
+    }
+}
@@ -0,0 +1,64 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeprom.h"
+#include "keymap_introspection.h"
+}
+
+class DynamicKeymap : public TestFixture {
+   protected:
+    void SetUp() override {
+        dynamic_keymap_reset();
+        dynamic_keymap_init();
+    }
+
+    // Reference lookup going straight to EEPROM, i.e. the uncached path.
+    static uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+    }
+};
+
+TEST_F(DynamicKeymap, CacheSizeIsLimitedByBudget) {
+    EXPECT_EQ(dynamic_keymap_get_cached_layer_count(), 2);
+}
+
+TEST_F(DynamicKeymap, CacheMatchesEepromAfterReset) {
+    for (uint8_t layer = 0; layer < dynamic_keymap_get_layer_count(); layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                EXPECT_EQ(dynamic_keymap_get_keycode(layer, row, column), eeprom_keycode(layer, row, column));
+            }
+        }
+    }
+}
+
+TEST_F(DynamicKeymap, SetKeycodeWritesThrough) {
+    dynamic_keymap_set_keycode(0, 1, 2, KC_A);
+    dynamic_keymap_set_keycode(3, 2, 1, KC_B);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 2), KC_A);
+    EXPECT_EQ(eeprom_keycode(0, 1, 2), KC_A);
+    EXPECT_EQ(keycode_at_keymap_location(0, 1, 2), KC_A);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(3, 2, 1), KC_B);
+    EXPECT_EQ(eeprom_keycode(3, 2, 1), KC_B);
+}
+
+TEST_F(DynamicKeymap, SetBufferWritesThrough) {
+    // Write a keycode straddling an odd offset, one byte at a time, the
+    // same way a host would with an unaligned raw HID transfer.
+    uint16_t offset  = (1 * MATRIX_ROWS * MATRIX_COLS + 3) * 2;
+    uint8_t  high[2] = {0x00, (uint8_t)(MO(2) >> 8)};
+    uint8_t  low[1]  = {(uint8_t)(MO(2) & 0xFF)};
+
+    dynamic_keymap_set_buffer(offset - 1, sizeof(high), high);
+    dynamic_keymap_set_buffer(offset + 1, sizeof(low), low);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 0, 3), MO(2));
+    EXPECT_EQ(eeprom_keycode(1, 0, 3), MO(2));
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 0, 2) & 0xFF, 0x00);
+}
@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define EEPROM_SIZE 1024
+#define DYNAMIC_KEYMAP_LAYER_COUNT 4
+#define DYNAMIC_KEYMAP_CACHE_ENABLE
+// Only cache the first two layers, the rest must be served from EEPROM
+#define DYNAMIC_KEYMAP_CACHE_MAX_SIZE (2 * MATRIX_ROWS * MATRIX_COLS * 2)
@@ -0,0 +1,62 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Cost of a keymap lookup served from EEPROM against one served from the
+ * dynamic keymap cache. Run with:
+ *
+ *     make bench:dynamic_keymap_benchmark
+ */
+
+#include <chrono>
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeprom.h"
+#include "keymap_introspection.h"
+}
+
+class DynamicKeymapBenchmark : public TestFixture {
+   protected:
+    void SetUp() override {
+        dynamic_keymap_reset();
+        dynamic_keymap_init();
+    }
+
+    // Reference lookup going straight to EEPROM, i.e. the uncached path.
+    static uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+    }
+};
+
+TEST_F(DynamicKeymapBenchmark, LookupCost) {
+    constexpr int iterations = 20000;
+    uint32_t      checksum   = 0;
+
+    // Only the cached layers, 0 and 1
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                checksum += eeprom_keycode(i & 1, row, column);
+            }
+        }
+    }
+    auto uncached = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                checksum -= keycode_at_keymap_location(i & 1, row, column);
+            }
+        }
+    }
+    auto cached = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(checksum, 0);
+
+    auto lookups = iterations * MATRIX_ROWS * MATRIX_COLS;
+    fprintf(stdout, "dynamic keymap lookup: eeprom %.2fns, cached %.2fns\n", std::chrono::duration<double, std::nano>(uncached).count() / lookups, std::chrono::duration<double, std::nano>(cached).count() / lookups);
+}
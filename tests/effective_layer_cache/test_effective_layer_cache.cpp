@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class EffectiveLayerCache : public TestFixture {};
+
+TEST_F(EffectiveLayerCache, MomentaryLayerUpdatesResolvedLayer) {
+    TestDriver driver;
+    KeymapKey  layer_key   = KeymapKey{0, 0, 0, MO(1)};
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+
+    set_keymap({layer_key, KeymapKey{1, 0, 0, KC_TRNS}, regular_key, KeymapKey{1, 1, 0, KC_B}});
+
+    /* Resolve the key once on the base layer so it is cached. */
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+
+    /* Press MO, the cached entry must be dropped. */
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 1);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release MO, back to the base layer. */
+    EXPECT_NO_REPORT(driver);
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(EffectiveLayerCache, TransparentKeyResolvesToLowerLayer) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+
+    set_keymap({regular_key, KeymapKey{1, 1, 0, KC_TRNS}, KeymapKey{2, 1, 0, KC_TRNS}});
+
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(EffectiveLayerCache, DefaultLayerChangeUpdatesResolvedLayer) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+
+    set_keymap({regular_key, KeymapKey{1, 1, 0, KC_B}});
+
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+
+    default_layer_set(1 << 1);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 1);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    default_layer_set(1 << 0);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+}
+
+TEST_F(EffectiveLayerCache, InvalidateAfterKeymapChange) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+
+    set_keymap({regular_key, KeymapKey{1, 1, 0, KC_TRNS}});
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+
+    /* Keymap edits bypassing the layer functions must invalidate explicitly. */
+    set_keymap({regular_key, KeymapKey{1, 1, 0, KC_B}});
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+    effective_layer_cache_invalidate();
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 1);
+}
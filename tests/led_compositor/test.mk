@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+LED_COMPOSITOR_ENABLE = yes
+WS2812_DRIVER = custom
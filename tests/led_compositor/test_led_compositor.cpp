@@ -0,0 +1,99 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "led_compositor.h"
+#include "ws2812.h"
+#include "ws2812_fake_driver.h"
+}
+
+class LedCompositor : public TestFixture {
+   protected:
+    void SetUp() override {
+        led_compositor_init();
+        for (uint8_t layer = 0; layer < LED_LAYER_COUNT; layer++) {
+            led_compositor_set_blend((led_layer_t)layer, LED_BLEND_NORMAL);
+            led_compositor_set_color_all((led_layer_t)layer, 0, 0, 0);
+        }
+        led_compositor_flush(LED_LAYER_RGBLIGHT);
+        led_compositor_task();
+        test_ws2812_flush_calls = 0;
+    }
+
+    void expect_led(int index, uint8_t red, uint8_t green, uint8_t blue) {
+        EXPECT_EQ(test_ws2812_strip[index].r, red) << "LED " << index;
+        EXPECT_EQ(test_ws2812_strip[index].g, green) << "LED " << index;
+        EXPECT_EQ(test_ws2812_strip[index].b, blue) << "LED " << index;
+    }
+};
+
+TEST_F(LedCompositor, FlushesOncePerFrame) {
+    led_compositor_set_color_all(LED_LAYER_RGBLIGHT, 0, 0, 255);
+    led_compositor_flush(LED_LAYER_RGBLIGHT);
+    led_compositor_set_color(LED_LAYER_RGB_MATRIX, 0, 255, 0, 0);
+    led_compositor_flush(LED_LAYER_RGB_MATRIX);
+
+    led_compositor_task();
+    EXPECT_EQ(test_ws2812_flush_calls, 1);
+    expect_led(0, 255, 0, 0);
+    expect_led(1, 0, 0, 255);
+
+    // nothing changed since
+    led_compositor_task();
+    EXPECT_EQ(test_ws2812_flush_calls, 1);
+}
+
+TEST_F(LedCompositor, ColoursAreOnlySentOnFlush) {
+    led_compositor_set_color(LED_LAYER_RGBLIGHT, 2, 10, 20, 30);
+    led_compositor_task();
+    EXPECT_EQ(test_ws2812_flush_calls, 0);
+    expect_led(2, 0, 0, 0);
+
+    led_compositor_flush(LED_LAYER_RGBLIGHT);
+    led_compositor_task();
+    EXPECT_EQ(test_ws2812_flush_calls, 1);
+    expect_led(2, 10, 20, 30);
+}
+
+TEST_F(LedCompositor, IndicatorsAreOnTop) {
+    led_compositor_set_color_all(LED_LAYER_RGBLIGHT, 0, 0, 255);
+    led_compositor_set_color_all(LED_LAYER_RGB_MATRIX, 0, 255, 0);
+    led_compositor_set_color(LED_LAYER_INDICATORS, 3, 255, 255, 255);
+    led_compositor_flush(LED_LAYER_INDICATORS);
+    led_compositor_task();
+
+    expect_led(0, 0, 255, 0);
+    expect_led(3, 255, 255, 255);
+}
+
+TEST_F(LedCompositor, BlendModes) {
+    led_compositor_set_color_all(LED_LAYER_RGBLIGHT, 200, 100, 0);
+    led_compositor_set_color_all(LED_LAYER_RGB_MATRIX, 100, 50, 20);
+
+    led_compositor_set_blend(LED_LAYER_RGB_MATRIX, LED_BLEND_ADD);
+    led_compositor_task();
+    expect_led(0, 255, 150, 20);
+
+    led_compositor_set_blend(LED_LAYER_RGB_MATRIX, LED_BLEND_LIGHTEN);
+    led_compositor_task();
+    expect_led(0, 200, 100, 20);
+
+    led_compositor_set_blend(LED_LAYER_RGB_MATRIX, LED_BLEND_OFF);
+    led_compositor_task();
+    expect_led(0, 200, 100, 0);
+
+    EXPECT_EQ(test_ws2812_flush_calls, 3);
+}
+
+TEST_F(LedCompositor, OutOfRangeIsIgnored) {
+    led_compositor_set_color(LED_LAYER_RGBLIGHT, WS2812_LED_COUNT, 255, 255, 255);
+    led_compositor_set_color(LED_LAYER_RGBLIGHT, -1, 255, 255, 255);
+    led_compositor_flush(LED_LAYER_RGBLIGHT);
+    led_compositor_task();
+
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        expect_led(i, 0, 0, 0);
+    }
+}
@@ -0,0 +1,16 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+// The RGB Matrix LEDs are the first two keys of the first row
+// clang-format off
+led_config_t g_led_config = {
+    {
+        { 0, 1, [2 ... MATRIX_COLS - 1] = NO_LED },
+        [1 ... MATRIX_ROWS - 1] = { [0 ... MATRIX_COLS - 1] = NO_LED },
+    },
+    { {0, 0}, {224, 0} },
+    { LED_FLAG_KEYLIGHT, LED_FLAG_KEYLIGHT },
+};
+// clang-format on
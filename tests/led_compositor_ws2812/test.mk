@@ -0,0 +1,11 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# RGBLIGHT and RGB Matrix on one chain, which enables the compositor
+RGBLIGHT_ENABLE = yes
+RGBLIGHT_DRIVER = ws2812
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = ws2812
+WS2812_DRIVER = custom
+
+SRC += led_config.c
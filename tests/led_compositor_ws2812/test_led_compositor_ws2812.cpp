@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "led_compositor.h"
+#include "rgblight.h"
+#include "rgb_matrix.h"
+#include "ws2812.h"
+#include "ws2812_fake_driver.h"
+}
+
+class LedCompositorWs2812 : public TestFixture {
+   protected:
+    TestDriver driver;
+
+    void SetUp() override {
+        rgblight_enable_noeeprom();
+        rgblight_mode_noeeprom(RGBLIGHT_MODE_STATIC_LIGHT);
+        rgblight_sethsv_noeeprom(HSV_BLUE);
+
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        rgb_matrix_sethsv_noeeprom(HSV_RED);
+
+        led_compositor_set_blend(LED_LAYER_RGB_MATRIX, LED_BLEND_NORMAL);
+        idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 3);
+    }
+
+    void expect_led(int index, uint8_t red, uint8_t green, uint8_t blue) {
+        EXPECT_EQ(test_ws2812_strip[index].r, red) << "LED " << index;
+        EXPECT_EQ(test_ws2812_strip[index].g, green) << "LED " << index;
+        EXPECT_EQ(test_ws2812_strip[index].b, blue) << "LED " << index;
+    }
+};
+
+TEST_F(LedCompositorWs2812, ChainIsSharedByBothEngines) {
+    EXPECT_EQ(WS2812_LED_COUNT, RGBLIGHT_LED_COUNT);
+
+    // RGB Matrix on top where it has LEDs, RGBLIGHT on the rest of the chain
+    expect_led(0, 255, 0, 0);
+    expect_led(1, 255, 0, 0);
+    expect_led(2, 0, 0, 255);
+    expect_led(3, 0, 0, 255);
+}
+
+TEST_F(LedCompositorWs2812, FlushesAtMostOncePerFrame) {
+    uint16_t start = test_ws2812_flush_calls;
+    for (int i = 0; i < 50; i++) {
+        uint16_t flushes = test_ws2812_flush_calls;
+        // Both engines update their layer during the same keyboard task
+        rgblight_sethsv_noeeprom(HSV_BLUE);
+        rgb_matrix_sethsv_noeeprom(HSV_RED);
+        run_one_scan_loop();
+        EXPECT_LE(test_ws2812_flush_calls - flushes, 1) << "scan " << i;
+    }
+    EXPECT_GT(test_ws2812_flush_calls - start, 0);
+}
+
+TEST_F(LedCompositorWs2812, LayersAreBlended) {
+    led_compositor_set_blend(LED_LAYER_RGB_MATRIX, LED_BLEND_ADD);
+    run_one_scan_loop();
+
+    expect_led(0, 255, 0, 255);
+    expect_led(1, 255, 0, 255);
+    expect_led(2, 0, 0, 255);
+}
+
+TEST_F(LedCompositorWs2812, RgblightChangeIsSent) {
+    uint16_t flushes = test_ws2812_flush_calls;
+    rgblight_sethsv_noeeprom(HSV_GREEN);
+    run_one_scan_loop();
+
+    EXPECT_EQ(test_ws2812_flush_calls - flushes, 1);
+    expect_led(0, 255, 0, 0);
+    expect_led(2, 0, 255, 0);
+    expect_led(3, 0, 255, 0);
+}
@@ -0,0 +1,116 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "perf_stats.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class PerfStats : public TestFixture {
+   protected:
+    void SetUp() override {
+        perf_stats_reset();
+    }
+};
+
+TEST_F(PerfStats, RecordFillsHistogramBuckets) {
+    perf_stats_record(PERF_STATS_MATRIX_TASK, 0);
+    perf_stats_record(PERF_STATS_MATRIX_TASK, 1);
+    perf_stats_record(PERF_STATS_MATRIX_TASK, 3);
+    perf_stats_record(PERF_STATS_MATRIX_TASK, 1000);
+    perf_stats_record(PERF_STATS_MATRIX_TASK, UINT32_MAX);
+
+    const perf_stats_t *stats = perf_stats_get(PERF_STATS_MATRIX_TASK);
+    EXPECT_EQ(stats->count, 5);
+    EXPECT_EQ(stats->last_us, UINT32_MAX);
+    EXPECT_EQ(stats->max_us, UINT32_MAX);
+    EXPECT_EQ(stats->histogram[0], 1);
+    EXPECT_EQ(stats->histogram[1], 1);
+    EXPECT_EQ(stats->histogram[2], 1);
+    EXPECT_EQ(stats->histogram[10], 1);
+    EXPECT_EQ(stats->histogram[PERF_STATS_HISTOGRAM_BUCKETS - 1], 1);
+}
+
+TEST_F(PerfStats, MainLoopTasksAreRecorded) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(perf_stats_get(PERF_STATS_KEYBOARD_TASK)->count, 10);
+    EXPECT_EQ(perf_stats_get(PERF_STATS_MATRIX_TASK)->count, 10);
+    EXPECT_EQ(perf_stats_get(PERF_STATS_QUANTUM_TASK)->count, 10);
+    EXPECT_EQ(perf_stats_get(PERF_STATS_HOUSEKEEPING_TASK)->count, 10);
+    EXPECT_EQ(perf_stats_get(PERF_STATS_SCAN_TO_REPORT)->count, 0);
+}
+
+TEST_F(PerfStats, ScanRateIsUpdatedEverySecond) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(1001);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(perf_stats_get_scan_rate(), 1001);
+}
+
+TEST_F(PerfStats, ScanToReportLatencyOfRegularKey) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const perf_stats_t *stats = perf_stats_get(PERF_STATS_SCAN_TO_REPORT);
+    EXPECT_EQ(stats->count, 2);
+    EXPECT_EQ(stats->max_us, 0);
+}
+
+TEST_F(PerfStats, ScanToReportLatencyOfHeldModTap) {
+    TestDriver driver;
+    KeymapKey  mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    /* The report is only sent once the tapping term has expired. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    const perf_stats_t *stats = perf_stats_get(PERF_STATS_SCAN_TO_REPORT);
+    EXPECT_EQ(stats->count, 1);
+    EXPECT_GE(stats->last_us, TAPPING_TERM * 1000);
+    EXPECT_LE(stats->last_us, (TAPPING_TERM + 1) * 1000);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PerfStats, ReadRaw) {
+    perf_stats_record(PERF_STATS_RGB_MATRIX_TASK, 0x12345678);
+
+    uint8_t buffer[sizeof(perf_stats_t) + 4] = {0};
+    EXPECT_EQ(perf_stats_read_raw(PERF_STATS_RGB_MATRIX_TASK, 0, buffer, sizeof(buffer)), sizeof(perf_stats_t));
+    EXPECT_EQ(memcmp(buffer, perf_stats_get(PERF_STATS_RGB_MATRIX_TASK), sizeof(perf_stats_t)), 0);
+
+    EXPECT_EQ(perf_stats_read_raw(PERF_STATS_RGB_MATRIX_TASK, sizeof(perf_stats_t) - 2, buffer, sizeof(buffer)), 2);
+    EXPECT_EQ(perf_stats_read_raw(PERF_STATS_COUNT, 0, buffer, sizeof(buffer)), 0);
+}
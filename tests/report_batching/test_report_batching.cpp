@@ -0,0 +1,82 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class ReportBatching : public TestFixture {};
+
+TEST_F(ReportBatching, ChordIsSentInASingleReport) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 1, KC_C);
+
+    set_keymap({key_a, key_b, key_c});
+
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code));
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportBatching, ModifierAndKeyAreSentInASingleReport) {
+    TestDriver driver;
+    auto       key_shift = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto       key_a     = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_shift, key_a});
+
+    key_shift.press();
+    key_a.press();
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_shift.release();
+    key_a.release();
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportBatching, TapWithinOneScanIsNotLost) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+    auto       key_a       = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({mod_tap_key, key_a});
+
+    mod_tap_key.press();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The tap is registered and unregistered while handling the release, the
+     * press of the other key in the same scan must not be merged with it. */
+    mod_tap_key.release();
+    key_a.press();
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
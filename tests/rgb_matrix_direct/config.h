@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 4
+#define ENABLE_RGB_MATRIX_DIRECT
+#define RGB_MATRIX_DEFAULT_MODE RGB_MATRIX_DIRECT
@@ -0,0 +1,66 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_fake_driver.h"
+}
+
+class RgbMatrixDirect : public TestFixture {
+   protected:
+    TestDriver driver;
+
+    void SetUp() override {
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_DIRECT);
+        rgb_matrix_sethsv_noeeprom(0, 0, UINT8_MAX);
+        rgb_matrix_direct_set_color_all(0, 0, 0);
+        render_frames(2);
+    }
+
+    void render_frames(uint8_t count) {
+        for (uint8_t i = 0; i < count; i++) {
+            idle_for(RGB_MATRIX_LED_FLUSH_LIMIT);
+            run_one_scan_loop();
+        }
+    }
+
+    void expect_led(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
+        EXPECT_EQ(rgb_matrix_fake_leds[index].r, r) << "LED " << (int)index;
+        EXPECT_EQ(rgb_matrix_fake_leds[index].g, g) << "LED " << (int)index;
+        EXPECT_EQ(rgb_matrix_fake_leds[index].b, b) << "LED " << (int)index;
+    }
+};
+
+TEST_F(RgbMatrixDirect, ShowsDirectColours) {
+    rgb_matrix_direct_set_color(1, 255, 0, 0);
+    rgb_matrix_direct_set_color(3, 10, 20, 30);
+    render_frames(2);
+
+    expect_led(0, 0, 0, 0);
+    expect_led(1, 255, 0, 0);
+    expect_led(2, 0, 0, 0);
+    expect_led(3, 10, 20, 30);
+}
+
+TEST_F(RgbMatrixDirect, BrightnessDimsDirectColours) {
+    rgb_matrix_direct_set_color_all(200, 100, 0);
+    rgb_matrix_sethsv_noeeprom(0, 0, 128);
+    render_frames(2);
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        expect_led(i, 100, 50, 0);
+    }
+}
+
+TEST_F(RgbMatrixDirect, OutOfRangeIsIgnored) {
+    rgb_matrix_direct_set_color(-1, 255, 255, 255);
+    rgb_matrix_direct_set_color(RGB_MATRIX_LED_COUNT, 255, 255, 255);
+    render_frames(2);
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        expect_led(i, 0, 0, 0);
+    }
+}
@@ -0,0 +1,15 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 6
+#define RGB_MATRIX_FAKE_LED_POINTS { {0, 0}, {20, 0}, {40, 0}, {60, 0}, {100, 0}, {0, 30} }
+#define ENABLE_RGB_MATRIX_TYPING_HEATMAP
+// normally set by post_config.h, which tests do not include
+#define RGB_MATRIX_FRAMEBUFFER_EFFECTS
+#define RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS 25
+// Room for the neighbours of the first LEDs only, the others look them up on every press
+#define RGB_MATRIX_TYPING_HEATMAP_NEIGHBOUR_LIMIT 4
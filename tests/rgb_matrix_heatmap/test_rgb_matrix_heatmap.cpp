@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_fake_driver.h"
+}
+
+using testing::_;
+
+class RgbMatrixHeatmap : public TestFixture {
+   protected:
+    TestDriver driver;
+
+    void SetUp() override {
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
+        idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 3);
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AnyNumber());
+    }
+
+    void tap(uint8_t col) {
+        KeymapKey key(0, col, 0, KC_A);
+        set_keymap({key});
+        key.press();
+        run_one_scan_loop();
+        key.release();
+        run_one_scan_loop();
+    }
+
+    void expect_heat(std::initializer_list<uint8_t> heat) {
+        uint8_t col = 0;
+        for (uint8_t expected : heat) {
+            EXPECT_EQ(g_rgb_frame_buffer[0][col], expected) << "column " << +col;
+            col++;
+        }
+    }
+};
+
+TEST_F(RgbMatrixHeatmap, PressSpreadsToNeighbours) {
+    // LED 0 has its neighbours in the table
+    tap(0);
+    expect_heat({32, 16, 0, 0, 0, 10});
+}
+
+TEST_F(RgbMatrixHeatmap, PressWithoutNeighbourTable) {
+    // LED 3 did not fit in the table
+    tap(3);
+    expect_heat({0, 0, 16, 32, 0, 0});
+}
+
+TEST_F(RgbMatrixHeatmap, HeatAddsUp) {
+    tap(0);
+    tap(1);
+    expect_heat({48, 48, 16, 0, 0, 14});
+}
+
+TEST_F(RgbMatrixHeatmap, DecaysOverTime) {
+    tap(4);
+    expect_heat({0, 0, 0, 0, 32, 0});
+
+    // only brought up to date when read, and not by whole frames
+    idle_for(RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS * 10 + 5);
+    EXPECT_NEAR(g_rgb_frame_buffer[0][4], 22, 1);
+    EXPECT_GT(rgb_matrix_fake_leds[4].b, 0);
+
+    idle_for(RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS * 32);
+    expect_heat({0, 0, 0, 0, 0, 0});
+    EXPECT_EQ(rgb_matrix_fake_leds[4].r | rgb_matrix_fake_leds[4].g | rgb_matrix_fake_leds[4].b, 0);
+}
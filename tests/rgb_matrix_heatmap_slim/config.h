@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 4
+#define ENABLE_RGB_MATRIX_TYPING_HEATMAP
+// normally set by post_config.h, which tests do not include
+#define RGB_MATRIX_FRAMEBUFFER_EFFECTS
+#define RGB_MATRIX_TYPING_HEATMAP_SLIM
+// decay once per frame
+#define RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS 0
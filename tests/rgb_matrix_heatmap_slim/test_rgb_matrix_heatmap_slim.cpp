@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_fake_driver.h"
+}
+
+using testing::_;
+
+class RgbMatrixHeatmapSlim : public TestFixture {
+   protected:
+    TestDriver driver;
+
+    void SetUp() override {
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
+        render_frames(3);
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AnyNumber());
+    }
+
+    void render_frames(uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            idle_for(RGB_MATRIX_LED_FLUSH_LIMIT);
+            run_one_scan_loop();
+        }
+    }
+
+    void tap(uint8_t row, uint8_t col) {
+        KeymapKey key(0, col, row, KC_A);
+        set_keymap({key});
+        key.press();
+        run_one_scan_loop();
+        key.release();
+        run_one_scan_loop();
+    }
+};
+
+TEST_F(RgbMatrixHeatmapSlim, DecaysOncePerFrame) {
+    tap(0, 1);
+    uint8_t heat = g_rgb_frame_buffer[0][1];
+    EXPECT_GT(heat, 20);
+
+    render_frames(10);
+    EXPECT_NEAR(g_rgb_frame_buffer[0][1], heat - 10, 1);
+}
+
+TEST_F(RgbMatrixHeatmapSlim, UnrenderedKeysDoNotWrap) {
+    // row 1 has no LEDs, so the renderer never reads it
+    tap(1, 0);
+    EXPECT_EQ(g_rgb_frame_buffer[1][0], 32);
+
+    // a whole 16 bit clock later, the old heat must not come back
+    render_frames(UINT16_MAX + 1);
+    tap(1, 0);
+    EXPECT_EQ(g_rgb_frame_buffer[1][0], 32);
+}
@@ -0,0 +1,36 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_fake_driver.h"
+
+// A keyboard level override, which the batched effect runners have to honour
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    return (rgb_t){.r = 1, .g = 2, .b = hsv.v};
+}
+}
+
+class RgbMatrixHsvOverride : public TestFixture {
+   protected:
+    TestDriver driver;
+
+    void SetUp() override {
+        rgb_matrix_fake_driver_reset();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(100, 255, 200);
+    }
+};
+
+TEST_F(RgbMatrixHsvOverride, RunnersUseTheOverride) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_ALL);
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 3);
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(rgb_matrix_fake_leds[i].r, 1) << "LED " << +i;
+        EXPECT_EQ(rgb_matrix_fake_leds[i].g, 2) << "LED " << +i;
+        EXPECT_EQ(rgb_matrix_fake_leds[i].b, 200) << "LED " << +i;
+    }
+}
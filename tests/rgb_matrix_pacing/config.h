@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 4
+#define RGB_MATRIX_LED_PROCESS_LIMIT 1
+#define RGB_MATRIX_TARGET_FPS 50
+#define RGB_MATRIX_RENDER_BUDGET_US 500
+#define RGB_MATRIX_DEFAULT_MODE RGB_MATRIX_SOLID_COLOR
@@ -0,0 +1,63 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_fake_driver.h"
+}
+
+class RgbMatrixPacing : public TestFixture {
+   protected:
+    TestDriver driver;
+
+    void SetUp() override {
+        rgb_matrix_fake_driver_reset();
+        // the test clock starts from zero again for every test
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        // settle, and start a fresh statistics window
+        idle_for(2000);
+        rgb_matrix_fake_set_color_calls = 0;
+    }
+};
+
+TEST_F(RgbMatrixPacing, FrameRateIsPaced) {
+    uint32_t dropped = rgb_matrix_get_render_stats().dropped_frames;
+
+    idle_for(1000);
+    EXPECT_EQ(rgb_matrix_get_render_stats().fps, 50);
+    EXPECT_EQ(rgb_matrix_get_render_stats().dropped_frames, dropped);
+    EXPECT_EQ(rgb_matrix_fake_set_color_calls, 50 * RGB_MATRIX_LED_COUNT);
+}
+
+TEST_F(RgbMatrixPacing, FastSlicesRenderWholeFrame) {
+    // run until the next frame starts
+    while (rgb_matrix_fake_set_color_calls == 0) {
+        run_one_scan_loop();
+    }
+    EXPECT_EQ(rgb_matrix_fake_set_color_calls, RGB_MATRIX_LED_COUNT);
+}
+
+TEST_F(RgbMatrixPacing, RendererYieldsWhenBudgetIsSpent) {
+    rgb_matrix_fake_set_color_time = 1;
+
+    while (rgb_matrix_fake_set_color_calls == 0) {
+        run_one_scan_loop();
+    }
+    EXPECT_EQ(rgb_matrix_fake_set_color_calls, 1);
+    run_one_scan_loop();
+    EXPECT_EQ(rgb_matrix_fake_set_color_calls, 2);
+}
+
+TEST_F(RgbMatrixPacing, SlowFlushDropsFrames) {
+    uint32_t dropped           = rgb_matrix_get_render_stats().dropped_frames;
+    rgb_matrix_fake_flush_time = 30;
+
+    idle_for(2000);
+    EXPECT_GT(rgb_matrix_get_render_stats().dropped_frames, dropped);
+    EXPECT_LT(rgb_matrix_get_render_stats().fps, 50);
+    EXPECT_GE(rgb_matrix_get_render_stats().worst_slice_us, 30000);
+}
@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 6
+#define RGB_MATRIX_FAKE_LED_POINTS { {0, 0}, {112, 32}, {224, 64}, {30, 60}, {200, 5}, {112, 0} }
+#define RGB_MATRIX_POLAR_TABLE
+#define ENABLE_RGB_MATRIX_CYCLE_SPIRAL
+#define ENABLE_RGB_MATRIX_CYCLE_PINWHEEL
+#define ENABLE_RGB_MATRIX_BAND_PINWHEEL_SAT
+#define ENABLE_RGB_MATRIX_BAND_SPIRAL_VAL
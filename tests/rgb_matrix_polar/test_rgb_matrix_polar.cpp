@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <functional>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_fake_driver.h"
+#include "lib/lib8tion/lib8tion.h"
+
+extern const led_point_t k_rgb_matrix_center;
+}
+
+class RgbMatrixPolar : public TestFixture {
+   protected:
+    TestDriver driver;
+
+    void SetUp() override {
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        // stop time, so that only the geometry affects the colours
+        rgb_matrix_set_speed_noeeprom(0);
+    }
+
+    void render(uint8_t mode) {
+        rgb_matrix_mode_noeeprom(mode);
+        idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 3);
+    }
+
+    // The LED colours as computed before the polar table existed
+    void expect_leds(std::function<hsv_t(hsv_t, int16_t, int16_t)> math) {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            int16_t dx       = g_led_config.point[i].x - k_rgb_matrix_center.x;
+            int16_t dy       = g_led_config.point[i].y - k_rgb_matrix_center.y;
+            rgb_t   expected = hsv_to_rgb(math(rgb_matrix_get_hsv(), dx, dy));
+            EXPECT_EQ(rgb_matrix_fake_leds[i].r, expected.r) << "LED " << +i;
+            EXPECT_EQ(rgb_matrix_fake_leds[i].g, expected.g) << "LED " << +i;
+            EXPECT_EQ(rgb_matrix_fake_leds[i].b, expected.b) << "LED " << +i;
+        }
+    }
+};
+
+TEST_F(RgbMatrixPolar, CycleSpiral) {
+    render(RGB_MATRIX_CYCLE_SPIRAL);
+    expect_leds([](hsv_t hsv, int16_t dx, int16_t dy) {
+        hsv.h = sqrt16(dx * dx + dy * dy) - atan2_8(dy, dx);
+        return hsv;
+    });
+}
+
+TEST_F(RgbMatrixPolar, CyclePinwheel) {
+    render(RGB_MATRIX_CYCLE_PINWHEEL);
+    expect_leds([](hsv_t hsv, int16_t dx, int16_t dy) {
+        hsv.h = atan2_8(dy, dx);
+        return hsv;
+    });
+}
+
+TEST_F(RgbMatrixPolar, BandPinwheelSat) {
+    render(RGB_MATRIX_BAND_PINWHEEL_SAT);
+    expect_leds([](hsv_t hsv, int16_t dx, int16_t dy) {
+        hsv.s = scale8(hsv.s - atan2_8(dy, dx) * 3, hsv.s);
+        return hsv;
+    });
+}
+
+TEST_F(RgbMatrixPolar, BandSpiralVal) {
+    render(RGB_MATRIX_BAND_SPIRAL_VAL);
+    expect_leds([](hsv_t hsv, int16_t dx, int16_t dy) {
+        hsv.v = scale8(hsv.v + sqrt16(dx * dx + dy * dy) - atan2_8(dy, dx), hsv.v);
+        return hsv;
+    });
+}
@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+# The same tests as rgb_matrix_polar, with the angles and distances computed every frame
+SRC += tests/rgb_matrix_polar/test_rgb_matrix_polar.cpp
@@ -0,0 +1,51 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_fake_driver.h"
+}
+
+class RgbMatrixShadow : public TestFixture {
+   protected:
+    TestDriver driver;
+
+    void SetUp() override {
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        rgb_matrix_sethsv_noeeprom(HSV_RED);
+        render_frames(2);
+        rgb_matrix_fake_driver_reset();
+    }
+
+    void render_frames(uint8_t count) {
+        for (uint8_t i = 0; i < count; i++) {
+            idle_for(RGB_MATRIX_LED_FLUSH_LIMIT);
+            run_one_scan_loop();
+        }
+    }
+};
+
+TEST_F(RgbMatrixShadow, StaticEffectSkipsDriver) {
+    render_frames(4);
+    EXPECT_EQ(rgb_matrix_fake_set_color_calls, 0);
+    EXPECT_EQ(rgb_matrix_fake_flush_calls, 0);
+    EXPECT_EQ(rgb_matrix_get_frame_stats().leds_changed, 0);
+}
+
+TEST_F(RgbMatrixShadow, OnlyChangedLedsReachDriver) {
+    rgb_matrix_set_color(2, 0, 0, 255);
+    rgb_matrix_update_pwm_buffers();
+    EXPECT_EQ(rgb_matrix_fake_set_color_calls, 1);
+    EXPECT_EQ(rgb_matrix_fake_flush_calls, 1);
+    EXPECT_EQ(rgb_matrix_get_frame_stats().leds_changed, 1);
+}
+
+TEST_F(RgbMatrixShadow, ColourChangeReachesEveryLed) {
+    rgb_matrix_sethsv_noeeprom(HSV_BLUE);
+    render_frames(2);
+    EXPECT_EQ(rgb_matrix_fake_set_color_calls, RGB_MATRIX_LED_COUNT);
+    EXPECT_GE(rgb_matrix_fake_flush_calls, 1);
+}
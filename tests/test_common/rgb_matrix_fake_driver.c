@@ -0,0 +1,76 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix_fake_driver.h"
+#include <string.h>
+#include "rgb_matrix.h"
+
+void advance_time(uint32_t ms);
+
+static void spend_time(uint32_t ms) {
+    if (ms) {
+        advance_time(ms);
+    }
+}
+
+#ifndef RGB_MATRIX_FAKE_LED_POINTS
+#    define RGB_MATRIX_FAKE_LED_POINTS \
+        { {0, 0}, {75, 0}, {150, 0}, {224, 0} }
+#endif
+
+_Static_assert(RGB_MATRIX_LED_COUNT <= MATRIX_COLS, "The fake RGB Matrix driver only has LEDs on the first matrix row");
+
+#define FAKE_LED(col) ((col) < RGB_MATRIX_LED_COUNT ? (col) : NO_LED)
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        { FAKE_LED(0), FAKE_LED(1), FAKE_LED(2), FAKE_LED(3), FAKE_LED(4), FAKE_LED(5), FAKE_LED(6), FAKE_LED(7), FAKE_LED(8), FAKE_LED(9) },
+        [1 ... MATRIX_ROWS - 1] = { [0 ... MATRIX_COLS - 1] = NO_LED },
+    },
+    RGB_MATRIX_FAKE_LED_POINTS,
+    { [0 ... RGB_MATRIX_LED_COUNT - 1] = LED_FLAG_KEYLIGHT },
+};
+// clang-format on
+
+rgb_t    rgb_matrix_fake_leds[RGB_MATRIX_LED_COUNT];
+uint16_t rgb_matrix_fake_set_color_calls;
+uint16_t rgb_matrix_fake_flush_calls;
+uint32_t rgb_matrix_fake_set_color_time;
+uint32_t rgb_matrix_fake_flush_time;
+
+void rgb_matrix_fake_driver_reset(void) {
+    memset(rgb_matrix_fake_leds, 0, sizeof(rgb_matrix_fake_leds));
+    rgb_matrix_fake_set_color_calls = 0;
+    rgb_matrix_fake_flush_calls     = 0;
+    rgb_matrix_fake_set_color_time  = 0;
+    rgb_matrix_fake_flush_time      = 0;
+}
+
+static void fake_init(void) {}
+
+static void fake_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    rgb_matrix_fake_leds[index] = (rgb_t){.r = r, .g = g, .b = b};
+    rgb_matrix_fake_set_color_calls++;
+    spend_time(rgb_matrix_fake_set_color_time);
+}
+
+static void fake_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_matrix_fake_leds[i] = (rgb_t){.r = r, .g = g, .b = b};
+    }
+    rgb_matrix_fake_set_color_calls += RGB_MATRIX_LED_COUNT;
+    spend_time(rgb_matrix_fake_set_color_time);
+}
+
+static void fake_flush(void) {
+    rgb_matrix_fake_flush_calls++;
+    spend_time(rgb_matrix_fake_flush_time);
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = fake_init,
+    .set_color     = fake_set_color,
+    .set_color_all = fake_set_color_all,
+    .flush         = fake_flush,
+};
@@ -0,0 +1,33 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/* RGB Matrix driver for tests built with RGB_MATRIX_DRIVER = custom. The
+ * LEDs are the first RGB_MATRIX_LED_COUNT keys of the first matrix row, at
+ * the points given by RGB_MATRIX_FAKE_LED_POINTS in the test's config.h. */
+
+#include <stdint.h>
+#include "color.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Colours last set through the driver
+extern rgb_t rgb_matrix_fake_leds[RGB_MATRIX_LED_COUNT];
+
+// set_color_all() counts as one call for every LED
+extern uint16_t rgb_matrix_fake_set_color_calls;
+extern uint16_t rgb_matrix_fake_flush_calls;
+
+// Simulated cost of the driver calls, in milliseconds
+extern uint32_t rgb_matrix_fake_set_color_time;
+extern uint32_t rgb_matrix_fake_flush_time;
+
+// Clear the LEDs, counters and simulated costs
+void rgb_matrix_fake_driver_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -2,3 +2,8 @@
 
 #define MATRIX_ROWS 4
 #define MATRIX_COLS 10
+
+#ifdef RGB_MATRIX_ENABLE
+// RGB Matrix settings live past the end of the default 32 byte test EEPROM
+#    define EEPROM_SIZE 64
+#endif
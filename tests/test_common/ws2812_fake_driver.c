@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "ws2812_fake_driver.h"
+
+rgb_t    test_ws2812_strip[WS2812_LED_COUNT];
+uint16_t test_ws2812_flush_calls;
+
+void ws2812_init(void) {}
+
+void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    test_ws2812_strip[index].r = red;
+    test_ws2812_strip[index].g = green;
+    test_ws2812_strip[index].b = blue;
+}
+
+void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        ws2812_set_color(i, red, green, blue);
+    }
+}
+
+void ws2812_flush(void) {
+    test_ws2812_flush_calls++;
+}
@@ -0,0 +1,23 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/* WS2812 driver for tests built with WS2812_DRIVER = custom. It records what
+ * is sent, in place of a real strip. */
+
+#include <stdint.h>
+#include "ws2812.h"
+#include "color.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Colours last sent to the strip
+extern rgb_t    test_ws2812_strip[WS2812_LED_COUNT];
+extern uint16_t test_ws2812_flush_calls;
+
+#ifdef __cplusplus
+}
+#endif
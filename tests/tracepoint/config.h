@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TRACEPOINT_BUFFER_SIZE 16
+#define TRACEPOINT_MANUAL_DRAIN
+#define TRACEPOINTS_USER(X) X(user_task)
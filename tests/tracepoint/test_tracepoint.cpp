@@ -0,0 +1,76 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "tracepoint.h"
+}
+
+using testing::_;
+
+class Tracepoint : public TestFixture {
+   protected:
+    void SetUp() override {
+        tracepoint_clear();
+    }
+
+    tracepoint_record_t read_one(void) {
+        tracepoint_record_t record = {0};
+        EXPECT_EQ(tracepoint_read((uint8_t *)&record, sizeof(record)), sizeof(record));
+        return record;
+    }
+};
+
+TEST_F(Tracepoint, UserTracepointsAreRegistered) {
+    EXPECT_STREQ(tracepoint_name(TRACEPOINT_keyboard_task), "keyboard_task");
+    EXPECT_STREQ(tracepoint_name(TRACEPOINT_user_task), "user_task");
+    EXPECT_EQ(tracepoint_name(TRACEPOINT_COUNT), nullptr);
+}
+
+TEST_F(Tracepoint, ScopeRecordsBeginAndEnd) {
+    bool called = false;
+    TRACE_SCOPE(user_task, { called = true; });
+    EXPECT_TRUE(called);
+    EXPECT_EQ(tracepoint_pending(), 2);
+
+    tracepoint_record_t begin = read_one();
+    tracepoint_record_t end   = read_one();
+    EXPECT_EQ(begin.id, TRACEPOINT_user_task);
+    EXPECT_EQ(begin.type, TRACEPOINT_BEGIN);
+    EXPECT_EQ(end.id, TRACEPOINT_user_task);
+    EXPECT_EQ(end.type, TRACEPOINT_END);
+    EXPECT_EQ(tracepoint_pending(), 0);
+}
+
+TEST_F(Tracepoint, MainLoopIsTraced) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    uint8_t ids[]   = {TRACEPOINT_keyboard_task, TRACEPOINT_matrix_task, TRACEPOINT_matrix_task, TRACEPOINT_keyboard_task, TRACEPOINT_housekeeping_task, TRACEPOINT_housekeeping_task};
+    uint8_t types[] = {TRACEPOINT_BEGIN, TRACEPOINT_BEGIN, TRACEPOINT_END, TRACEPOINT_END, TRACEPOINT_BEGIN, TRACEPOINT_END};
+    EXPECT_EQ(tracepoint_pending(), sizeof(ids));
+    for (uint8_t i = 0; i < sizeof(ids); i++) {
+        tracepoint_record_t record = read_one();
+        EXPECT_EQ(record.id, ids[i]);
+        EXPECT_EQ(record.type, types[i]);
+    }
+}
+
+TEST_F(Tracepoint, FullBufferDropsEvents) {
+    for (uint8_t i = 0; i < TRACEPOINT_BUFFER_SIZE + 4; i++) {
+        TRACE_INSTANT(user_task);
+    }
+
+    // One slot is kept free to tell a full buffer from an empty one
+    EXPECT_EQ(tracepoint_pending(), TRACEPOINT_BUFFER_SIZE - 1);
+    EXPECT_EQ(tracepoint_dropped(), 5);
+
+    uint8_t data[sizeof(tracepoint_record_t) * 4];
+    EXPECT_EQ(tracepoint_read(data, sizeof(data) - 1), sizeof(tracepoint_record_t) * 3);
+    EXPECT_EQ(tracepoint_pending(), TRACEPOINT_BUFFER_SIZE - 4);
+}